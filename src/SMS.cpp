@@ -5,8 +5,21 @@ SMS::SMS(ConsoleRegion region, ConsoleMapper mapper, std::string filename)
 	//Start with no Cartridge inserted, run from BIOS
 	bCartInserted = false;
 
+	//Init Memory Map
+	nMapGeneration = 0;
+	pageRead.fill(nullptr);
+	pageWrite.fill(nullptr);
+
+	//Every Frame is rendered by default
+	nFrameSkip = 0;
+	bAdaptiveSkip = false;
+	nSkipped = 0;
+	bFrameSkipped = false;
+
 	//Init MasterClock
-	masterclock_cycles = 0;
+	vdp_sync_cycles = 0;
+	vdp_event_cycles = 0;
+	psg_sync_cycles = 0;
 
 	//Connect to CPU
 	cpu.ConnectBus(this);
@@ -68,7 +81,7 @@ bool SMS::SetRegion(ConsoleRegion region)
 	
 	return true;
 }
-uint8_t SMS::readMem(uint16_t addr)
+uint8_t SMS::readMemSlow(uint16_t addr)
 {
 	uint8_t data = 0x00;
 
@@ -104,7 +117,7 @@ uint8_t SMS::readMem(uint16_t addr)
 	return data;
 }
 
-void SMS::writeMem(uint16_t addr, uint8_t data)
+void SMS::writeMemSlow(uint16_t addr, uint8_t data)
 {
 	//Write to Cartridge RAM Slot 2 (0x8000 - 0xbfff)
 	//Bit 3 Must be Set on Register 0xfffc to override Cartridge Slot 2
@@ -137,7 +150,62 @@ void SMS::writeMem(uint16_t addr, uint8_t data)
 	{
 		if (bCartInserted)
 			cart->write(addr, data);
+		UpdateMemoryMap();
+	}
+}
+
+//Rebuild the Memory Page Table, called whenever the Mapper Control Registers or the
+//Memory Enables change
+void SMS::UpdateMemoryMap()
+{
+	for (int page = 0; page < 64; page++)
+	{
+		uint16_t addr = page << 10;
+		uint8_t* rd = nullptr;
+		uint8_t* wr = nullptr;
+
+		if (addr <= 0xbfff)
+		{
+			//Cartridge ROM Slot 0, 1 and 2 or Cartridge RAM Slot 2, alternatively BIOS ROM
+			if (bCartInserted)
+			{
+				rd = cart->readPtr(addr);
+				wr = cart->writePtr(addr);
+			}
+			else if (bios)
+			{
+				rd = bios->readPtr(addr);
+			}
+		}
+		else if (mem.SystemRamEnabled())
+		{
+			//8K System RAM, Mirrored
+			rd = wr = &ram[addr & 0x1fff];
+		}
+		else if (bCartInserted)
+		{
+			//Cartridge RAM Slot 3
+			rd = cart->readPtr(addr);
+			wr = cart->writePtr(addr);
+		}
+
+		pageRead[page] = rd;
+		pageWrite[page] = wr;
 	}
+
+	//Mapper Control Registers sit in the last page, writes there always go thru the slow path
+	pageWrite[63] = nullptr;
+
+	nMapGeneration++;
+}
+
+bool SMS::GetRomAddress(uint16_t addr, uint32_t& romaddr)
+{
+	//Only Cartridge Slot 0, 1 and 2 can be mapped to ROM
+	if (bCartInserted && addr <= 0xbfff)
+		return cart->romMap(addr, romaddr);
+
+	return false;
 }
 
 uint8_t SMS::readIO(uint8_t addr)
@@ -153,19 +221,21 @@ uint8_t SMS::readIO(uint8_t addr)
 		mem.read(mirror_addr, data);
 		break;
 	case 0x40:
-		//V Counter - All Mirror of 0x7e
-		vdp.read(mirror_addr, data);
+		//V Counter - All Mirror of 0x7e, derived from the timestamp without running the VDP
+		data = vdp.GetVCounter(GetVDPClocks(GetMasterClock()));
 		break;
 	case 0x41:
-		//H Counter - All Mirror of 0x7f
-		vdp.read(mirror_addr, data);
+		//H Counter - All Mirror of 0x7f, derived from the timestamp without running the VDP
+		data = vdp.GetHCounter(GetVDPClocks(GetMasterClock()));
 		break;
 	case 0x80:
 		//VDP Data Port - All Mirror of 0xbe
+		SyncVDP(GetMasterClock());
 		vdp.read(mirror_addr, data);
 		break;
 	case 0x81:
 		//VDP Control Port - All Mirror of 0xbf
+		SyncVDP(GetMasterClock());
 		vdp.read(mirror_addr, data);
 		break;
 	case 0xc0:
@@ -191,6 +261,7 @@ void SMS::writeIO(uint8_t addr, uint8_t data)
 	case 0x00:
 		//Memory Enables - All Mirror of 0x3e
 		mem.write(mirror_addr, data);
+		UpdateMemoryMap();
 		break;
 	case 0x01:
 		//Joystick Port Control - All Mirror of 0x3f
@@ -198,28 +269,66 @@ void SMS::writeIO(uint8_t addr, uint8_t data)
 		break;
 	case 0x40:
 		//PSG - SN76480 - All Mirror of 0x7e
+		SyncPSG(GetMasterClock());
 		psg.write(mirror_addr, data);
 		break;
 	case 0x41:
 		//PSG - SN76480 - All Mirror of 0x7f 
+		SyncPSG(GetMasterClock());
 		psg.write(mirror_addr, data);
 		break;
 	case 0x80:
 		//VDP Data Port - All Mirror of 0xbe
+		SyncVDP(GetMasterClock());
 		vdp.write(mirror_addr, data);
 		break;
 	case 0x81:
-		//VDP Control Port - All Mirror of 0xbf
+		//VDP Control Port - All Mirror of 0xbf, Register writes can move the next Interrupt
+		SyncVDP(GetMasterClock());
 		vdp.write(mirror_addr, data);
+		ScheduleVDPEvent();
 		break;
 	}
 
 	return;
 }
 
+//Classify the I/O Port read by an idle loop, see Z80A::idleLoop()
+SMS::IDLEPORT SMS::GetIdlePort(uint8_t addr)
+{
+	switch (addr & 0xc1)
+	{
+	case 0x41:
+	case 0x80:
+		return IDLE_UNSAFE;
+	case 0x40:
+		return IDLE_VCOUNTER;
+	case 0x81:
+		return IDLE_STATUS;
+	}
+
+	return IDLE_STABLE;
+}
+
+//Last CPU Cycle an Instruction can start at and still read from the V Counter (and the VDP
+//Status if status is set) what an idle loop has read since the VDP Status Generation given.
+//Returns 0 if they already changed
+uint64_t SMS::GetIdleCycleLimit(uint32_t generation, bool status)
+{
+	SyncVDP(GetMasterClock());
+	if (vdp.GetStatusGeneration() != generation)
+		return 0;
+
+	//Master Clock timestamp of the VDP clock that can change them
+	uint64_t change_cycles = vdp_sync_cycles + (vdp.GetClocksToNextChange(status) - 1) * 2;
+
+	return (change_cycles - 1) / 3;
+}
+
 bool SMS::InsertCartridge()
 {
 	bCartInserted = true;
+	UpdateMemoryMap();
 	
 	return true;
 }
@@ -227,24 +336,99 @@ bool SMS::InsertCartridge()
 bool SMS::RemoveCartridge()
 {
 	bCartInserted = false;
+	UpdateMemoryMap();
 	
 	return true;
 }
 
 bool SMS::NewFrame()
 {
+	////////////////////////////////////////////////////////////////////////////////////////////
+	// Master Clock is the actual clock of the VDP
+	// NTSC = 10.738635 MHz
+	// PAL  = 10.640685 MHz
+	//
+	// The VDP is clocked at 1/2 the master clock frequency
+	// The CPU is clocked at 1/3 the master clock frequency
+	// The PSG is clocked at 1/3 the master clock frequency
+	//
+	// Realtime simulation depends on the Frame per second which are different for NTSC and PAL
+	//
+	// NTSC = ~60 frame per second
+	// PAL  = ~50 frame per second
+	//
+	// The CPU drives the emulation and runs up to the next VDP event (an enabled Line or Frame
+	// Interrupt or the End of Frame). VDP and PSG are clocked only to catch up with the CPU
+	// timestamp when an I/O Port access or a scheduled event needs them, the V and H Counters
+	// are derived from the timestamp. Within the same Master Clock cycle the VDP is always
+	// clocked before the CPU, and the PSG after it.
+	///////////////////////////////////////////////////////////////////////////////////////////
+	bFrameSkipped = SkipNextFrame();
+	vdp.SetSkipFrame(bFrameSkipped);
+
 	do
 	{
-		clock();
+		ScheduleVDPEvent();
+
+		//Run the CPU Instructions starting before the event. The run ends early if a Register
+		//write moved the event, it's handled by the VDP only once reached
+		if (GetMasterClock() < vdp_event_cycles)
+			cpu.run((int)((vdp_event_cycles - GetMasterClock() + 2) / 3));
+		if (GetMasterClock() < vdp_event_cycles)
+			continue;
+		SyncVDP(vdp_event_cycles);
+
+		//Complete the Master Clock cycle at the End of Frame
+		if (vdp.bFrameComplete)
+		{
+			if (GetMasterClock() == vdp_event_cycles)
+				cpu.step();
+			SyncPSG(vdp_event_cycles + 1);
+		}
 	} while (!vdp.bFrameComplete);
 	vdp.bFrameComplete = false;
 		
 	return true;
 }
 
+//Set the Frameskip policy: skip the given number of Frames after each rendered one, or if adaptive
+//skip up to that many Frames in a row while the Host can't keep up with the Frame rate
+void SMS::SetFrameSkip(uint8_t frames, bool adaptive)
+{
+	nFrameSkip = frames;
+	bAdaptiveSkip = adaptive;
+	nSkipped = frames;
+	tpLastFrame = std::chrono::steady_clock::now();
+}
+
+//Whether the Frame about to be emulated is skipped. The Host is late when more than one and a
+//half Frame went by since the previous one. The first Frame after a change is always rendered
+bool SMS::SkipNextFrame()
+{
+	bool skip = false;
+
+	if (bAdaptiveSkip)
+	{
+		auto now = std::chrono::steady_clock::now();
+		std::chrono::duration<float> elapsed = now - tpLastFrame;
+		tpLastFrame = now;
+
+		skip = (elapsed.count() > frameDuration * 1.5f) && (nSkipped < nFrameSkip);
+	}
+	else
+	{
+		skip = (nSkipped < nFrameSkip);
+	}
+
+	nSkipped = skip ? nSkipped + 1 : 0;
+
+	return skip;
+}
+
 bool SMS::reset()
 {
-	masterclock_cycles = 0;
+	vdp_sync_cycles = 0;
+	psg_sync_cycles = 0;
 
 	vdp.reset();
 	cpu.reset();
@@ -255,7 +439,8 @@ bool SMS::reset()
 
 bool SMS::reset(uint16_t org)
 {
-	masterclock_cycles = 0;
+	vdp_sync_cycles = 0;
+	psg_sync_cycles = 0;
 	
 	vdp.reset();
 	cpu.reset();
@@ -266,28 +451,40 @@ bool SMS::reset(uint16_t org)
 	return true;
 }
 
-bool SMS::clock()
+void SMS::SyncVDP(uint64_t timestamp)
 {
-	////////////////////////////////////////////////////////////////////////////////////////////
-	// Master Clock is the actual clock of the VDP
-	// NTSC = 10.738635 MHz
-	// PAL  = 10.640685 MHz
-	//
-	// The VDP is clocked at 1/2 the master clock frequency
-	// The CPU is clocked at 1/3 the master clock frequency
-	// The PSG is clocked at 1/3 the master clock frequency
-	//
-	// Realtime simulation depends on the Frame per second which are different for NTSC and PAL
-	//
-	// NTSC = ~60 frame per second
-	// PAL  = ~50 frame per second
-	///////////////////////////////////////////////////////////////////////////////////////////
+	//Clock the VDP up to the given Master Clock timestamp (included)
+	if (vdp_sync_cycles <= timestamp)
+	{
+		uint64_t clocks = (timestamp - vdp_sync_cycles) / 2 + 1;
 
-	(masterclock_cycles % 2) ? 0 : vdp.clock();
-	(masterclock_cycles % 3) ? 0 : cpu.clock();
-	(masterclock_cycles % 3) ? 0 : psg.clock();
-	
-	masterclock_cycles++;
+		vdp.run((uint32_t)clocks);
+		vdp_sync_cycles += clocks * 2;
+	}
+}
 
-	return true;
+//Number of VDP clocks, the last one included, from the next VDP clock to the given Master Clock
+//timestamp
+uint32_t SMS::GetVDPClocks(uint64_t timestamp)
+{
+	return (vdp_sync_cycles <= timestamp) ? (uint32_t)((timestamp - vdp_sync_cycles) / 2 + 1) : 0;
+}
+
+//Schedule the next VDP event, the CPU run in progress is cut short if it comes earlier
+void SMS::ScheduleVDPEvent()
+{
+	vdp_event_cycles = vdp_sync_cycles + (uint64_t)(vdp.GetClocksToNextEvent() - 1) * 2;
+	cpu.LimitRun((vdp_event_cycles + 2) / 3);
+}
+
+void SMS::SyncPSG(uint64_t timestamp)
+{
+	//Clock the PSG up to the given Master Clock timestamp (excluded)
+	if (psg_sync_cycles < timestamp)
+	{
+		uint64_t clocks = (timestamp - psg_sync_cycles + 2) / 3;
+
+		psg.run((uint32_t)clocks);
+		psg_sync_cycles += clocks * 3;
+	}
 }
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include "psg.h"
 #include "sms.h"
 
@@ -143,6 +144,31 @@ bool PSG::clock()
 	return true;
 }
 
+//Run the PSG for the given number of clocks. Only the clocks stepping the Tone and Noise
+//Generators (every 16) or producing a Sample (every 81) do any work, the PSG jumps from one
+//to the next
+bool PSG::run(uint32_t clocks)
+{
+	while (clocks > 0)
+	{
+		uint32_t toStep = (16 - m_nClockCounter % 16) % 16;
+		uint32_t toSample = (81 - m_nClockCounter % 81) % 81;
+
+		if ((toStep == 0) || (toSample == 0))
+		{
+			clock();
+			clocks--;
+			continue;
+		}
+
+		uint32_t n = std::min({ clocks, toStep, toSample });
+		m_nClockCounter += n;
+		clocks -= n;
+	}
+
+	return true;
+}
+
 float PSG::GetSample()
 {
 	return m_audioBuffer.GetSample();
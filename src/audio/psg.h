@@ -29,6 +29,7 @@ public:
 	bool write(uint8_t addr, uint8_t data);
 	bool reset();
 	bool clock();
+	bool run(uint32_t clocks);
 	float GetSample();
 	int GetSamplePerFrame();
 	
@@ -1,9 +1,3662 @@
 #include <loguru.hpp>
+#include <cstring>
+#include <algorithm>
 #include "z80a.h"
 #include "sms.h"
 
 //using Register
 
+//Instruction Dictionary - Hot Table used by the Interpreter, indexed by the decoded Opcode
+// 0x000 - MAIN, 0x100 - CB, 0x200 - DD, 0x300 - ED, 0x400 - FD, 0x500 - DD CB, 0x600 - FD CB
+using z = Z80A;
+
+constexpr Z80A::INSTRUCTION Z80A::instSet[0x700] =
+{
+	//MAIN Instruction Set
+	{ &z::NOP, 4, 0, 1 },
+	{ &z::LDDDNN, 10, 0, 3 },
+	{ &z::LDiBCA, 7, 0, 1 },
+	{ &z::INCSS, 6, 0, 1 },
+	{ &z::INCR, 4, 0, 1 },
+	{ &z::DECR, 4, 0, 1 },
+	{ &z::LDRN, 7, 0, 2 },
+	{ &z::RLCA, 4, 0, 1 },
+	{ &z::EXAF, 4, 0, 1 },
+	{ &z::ADDHLSS, 11, 0, 1 },
+	{ &z::LDAiBC, 7, 0, 1 },
+	{ &z::DECSS, 6, 0, 1 },
+	{ &z::INCR, 4, 0, 1 },
+	{ &z::DECR, 4, 0, 1 },
+	{ &z::LDRN, 7, 0, 2 },
+	{ &z::RRCA, 4, 0, 1 },
+	{ &z::DJNZE, 13, 8, 2 },
+	{ &z::LDDDNN, 10, 0, 3 },
+	{ &z::LDiDEA, 7, 0, 1 },
+	{ &z::INCSS, 6, 0, 1 },
+	{ &z::INCR, 4, 0, 1 },
+	{ &z::DECR, 4, 0, 1 },
+	{ &z::LDRN, 7, 0, 2 },
+	{ &z::RLA, 4, 0, 1 },
+	{ &z::JRE, 12, 0, 2 },
+	{ &z::ADDHLSS, 11, 0, 1 },
+	{ &z::LDAiDE, 7, 0, 1 },
+	{ &z::DECSS, 6, 0, 1 },
+	{ &z::INCR, 4, 0, 1 },
+	{ &z::DECR, 4, 0, 1 },
+	{ &z::LDRN, 7, 0, 2 },
+	{ &z::RRA, 4, 0, 1 },
+	{ &z::JRNZE, 12, 7, 2 },
+	{ &z::LDDDNN, 10, 0, 3 },
+	{ &z::LDiNNHL, 16, 0, 3 },
+	{ &z::INCSS, 6, 0, 1 },
+	{ &z::INCR, 4, 0, 1 },
+	{ &z::DECR, 4, 0, 1 },
+	{ &z::LDRN, 7, 0, 2 },
+	{ &z::DAA, 4, 0, 1 },
+	{ &z::JRZE, 12, 7, 2 },
+	{ &z::ADDHLSS, 11, 0, 1 },
+	{ &z::LDHLiNN, 16, 0, 3 },
+	{ &z::DECSS, 6, 0, 1 },
+	{ &z::INCR, 4, 0, 1 },
+	{ &z::DECR, 4, 0, 1 },
+	{ &z::LDRN, 7, 0, 2 },
+	{ &z::CPL, 4, 0, 1 },
+	{ &z::JRNCE, 12, 7, 2 },
+	{ &z::LDDDNN, 10, 0, 3 },
+	{ &z::LDiNNA, 13, 0, 3 },
+	{ &z::INCSS, 6, 0, 1 },
+	{ &z::INCR, 11, 0, 1 },
+	{ &z::DECR, 11, 0, 1 },
+	{ &z::LDRN, 10, 0, 2 },
+	{ &z::SCF, 4, 0, 1 },
+	{ &z::JRCE, 12, 7, 2 },
+	{ &z::ADDHLSS, 11, 0, 1 },
+	{ &z::LDAiNN, 13, 0, 3 },
+	{ &z::DECSS, 6, 0, 1 },
+	{ &z::INCR, 4, 0, 1 },
+	{ &z::DECR, 4, 0, 1 },
+	{ &z::LDRN, 7, 0, 2 },
+	{ &z::CCF, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRRi, 7, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRRi, 7, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRRi, 7, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRRi, 7, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRRi, 7, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRRi, 7, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDiRR, 7, 0, 1 },
+	{ &z::LDiRR, 7, 0, 1 },
+	{ &z::LDiRR, 7, 0, 1 },
+	{ &z::LDiRR, 7, 0, 1 },
+	{ &z::LDiRR, 7, 0, 1 },
+	{ &z::LDiRR, 7, 0, 1 },
+	{ &z::HALT, 4, 0, 1 },
+	{ &z::LDiRR, 7, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::LDRRi, 7, 0, 1 },
+	{ &z::LDRR, 4, 0, 1 },
+	{ &z::ADDR, 4, 0, 1 },
+	{ &z::ADDR, 4, 0, 1 },
+	{ &z::ADDR, 4, 0, 1 },
+	{ &z::ADDR, 4, 0, 1 },
+	{ &z::ADDR, 4, 0, 1 },
+	{ &z::ADDR, 4, 0, 1 },
+	{ &z::ADDR, 7, 0, 1 },
+	{ &z::ADDR, 4, 0, 1 },
+	{ &z::ADCR, 4, 0, 1 },
+	{ &z::ADCR, 4, 0, 1 },
+	{ &z::ADCR, 4, 0, 1 },
+	{ &z::ADCR, 4, 0, 1 },
+	{ &z::ADCR, 4, 0, 1 },
+	{ &z::ADCR, 4, 0, 1 },
+	{ &z::ADCR, 7, 0, 1 },
+	{ &z::ADCR, 4, 0, 1 },
+	{ &z::SUBR, 4, 0, 1 },
+	{ &z::SUBR, 4, 0, 1 },
+	{ &z::SUBR, 4, 0, 1 },
+	{ &z::SUBR, 4, 0, 1 },
+	{ &z::SUBR, 4, 0, 1 },
+	{ &z::SUBR, 4, 0, 1 },
+	{ &z::SUBR, 7, 0, 1 },
+	{ &z::SUBR, 4, 0, 1 },
+	{ &z::SBCR, 4, 0, 1 },
+	{ &z::SBCR, 4, 0, 1 },
+	{ &z::SBCR, 4, 0, 1 },
+	{ &z::SBCR, 4, 0, 1 },
+	{ &z::SBCR, 4, 0, 1 },
+	{ &z::SBCR, 4, 0, 1 },
+	{ &z::SBCR, 7, 0, 1 },
+	{ &z::SBCR, 4, 0, 1 },
+	{ &z::ANDR, 4, 0, 1 },
+	{ &z::ANDR, 4, 0, 1 },
+	{ &z::ANDR, 4, 0, 1 },
+	{ &z::ANDR, 4, 0, 1 },
+	{ &z::ANDR, 4, 0, 1 },
+	{ &z::ANDR, 4, 0, 1 },
+	{ &z::ANDR, 7, 0, 1 },
+	{ &z::ANDR, 4, 0, 1 },
+	{ &z::XORR, 4, 0, 1 },
+	{ &z::XORR, 4, 0, 1 },
+	{ &z::XORR, 4, 0, 1 },
+	{ &z::XORR, 4, 0, 1 },
+	{ &z::XORR, 4, 0, 1 },
+	{ &z::XORR, 4, 0, 1 },
+	{ &z::XORR, 7, 0, 1 },
+	{ &z::XORR, 4, 0, 1 },
+	{ &z::ORR, 4, 0, 1 },
+	{ &z::ORR, 4, 0, 1 },
+	{ &z::ORR, 4, 0, 1 },
+	{ &z::ORR, 4, 0, 1 },
+	{ &z::ORR, 4, 0, 1 },
+	{ &z::ORR, 4, 0, 1 },
+	{ &z::ORR, 7, 0, 1 },
+	{ &z::ORR, 4, 0, 1 },
+	{ &z::CPR, 4, 0, 1 },
+	{ &z::CPR, 4, 0, 1 },
+	{ &z::CPR, 4, 0, 1 },
+	{ &z::CPR, 4, 0, 1 },
+	{ &z::CPR, 4, 0, 1 },
+	{ &z::CPR, 4, 0, 1 },
+	{ &z::CPR, 7, 0, 1 },
+	{ &z::CPR, 4, 0, 1 },
+	{ &z::RETCC, 11, 5, 1 },
+	{ &z::POPQQ, 10, 0, 1 },
+	{ &z::JPCCNN, 10, 0, 3 },
+	{ &z::JPNN, 10, 0, 3 },
+	{ &z::CALLCCNN, 17, 10, 3 },
+	{ &z::PUSHQQ, 11, 0, 1 },
+	{ &z::ADDN, 7, 0, 2 },
+	{ &z::RSTP, 11, 0, 1 },
+	{ &z::RETCC, 11, 5, 1 },
+	{ &z::RET, 10, 0, 1 },
+	{ &z::JPCCNN, 10, 0, 3 },
+	{ &z::INVAL, 0, 0, 1 },
+	{ &z::CALLCCNN, 17, 10, 3 },
+	{ &z::CALLNN, 17, 0, 3 },
+	{ &z::ADCN, 7, 0, 2 },
+	{ &z::RSTP, 11, 0, 1 },
+	{ &z::RETCC, 11, 5, 1 },
+	{ &z::POPQQ, 10, 0, 1 },
+	{ &z::JPCCNN, 10, 0, 3 },
+	{ &z::OUTiNA, 11, 0, 2 },
+	{ &z::CALLCCNN, 17, 10, 3 },
+	{ &z::PUSHQQ, 11, 0, 1 },
+	{ &z::SUBN, 7, 0, 2 },
+	{ &z::RSTP, 11, 0, 1 },
+	{ &z::RETCC, 11, 5, 1 },
+	{ &z::EXX, 4, 0, 1 },
+	{ &z::JPCCNN, 10, 0, 3 },
+	{ &z::INAiN, 11, 0, 2 },
+	{ &z::CALLCCNN, 17, 10, 3 },
+	{ &z::INVAL, 0, 0, 1 },
+	{ &z::SBCN, 7, 0, 2 },
+	{ &z::RSTP, 11, 0, 1 },
+	{ &z::RETCC, 11, 5, 1 },
+	{ &z::POPQQ, 10, 0, 1 },
+	{ &z::JPCCNN, 10, 0, 3 },
+	{ &z::EXiSPHL, 19, 0, 1 },
+	{ &z::CALLCCNN, 17, 10, 3 },
+	{ &z::PUSHQQ, 11, 0, 1 },
+	{ &z::ANDN, 7, 0, 2 },
+	{ &z::RSTP, 11, 0, 1 },
+	{ &z::RETCC, 11, 5, 1 },
+	{ &z::JPiHL, 4, 0, 1 },
+	{ &z::JPCCNN, 10, 0, 3 },
+	{ &z::EXDEHL, 4, 0, 1 },
+	{ &z::CALLCCNN, 17, 10, 3 },
+	{ &z::INVAL, 0, 0, 1 },
+	{ &z::XORN, 7, 0, 2 },
+	{ &z::RSTP, 11, 0, 1 },
+	{ &z::RETCC, 11, 5, 1 },
+	{ &z::POPQQ, 10, 0, 1 },
+	{ &z::JPCCNN, 10, 0, 3 },
+	{ &z::DI, 4, 0, 1 },
+	{ &z::CALLCCNN, 17, 10, 3 },
+	{ &z::PUSHQQ, 11, 0, 1 },
+	{ &z::ORN, 7, 0, 2 },
+	{ &z::RSTP, 11, 0, 1 },
+	{ &z::RETCC, 11, 5, 1 },
+	{ &z::LDSPHL, 6, 0, 1 },
+	{ &z::JPCCNN, 10, 0, 3 },
+	{ &z::EI, 4, 0, 1 },
+	{ &z::CALLCCNN, 17, 10, 3 },
+	{ &z::INVAL, 0, 0, 1 },
+	{ &z::CPN, 7, 0, 2 },
+	{ &z::RSTP, 11, 0, 1 },
+
+	//BIT Instruction Set
+	{ &z::RLCR, 8, 0, 2 },
+	{ &z::RLCR, 8, 0, 2 },
+	{ &z::RLCR, 8, 0, 2 },
+	{ &z::RLCR, 8, 0, 2 },
+	{ &z::RLCR, 8, 0, 2 },
+	{ &z::RLCR, 8, 0, 2 },
+	{ &z::RLCR, 15, 0, 2 },
+	{ &z::RLCR, 8, 0, 2 },
+	{ &z::RRCR, 8, 0, 2 },
+	{ &z::RRCR, 8, 0, 2 },
+	{ &z::RRCR, 8, 0, 2 },
+	{ &z::RRCR, 8, 0, 2 },
+	{ &z::RRCR, 8, 0, 2 },
+	{ &z::RRCR, 8, 0, 2 },
+	{ &z::RRCR, 15, 0, 2 },
+	{ &z::RRCR, 8, 0, 2 },
+	{ &z::RLR, 8, 0, 2 },
+	{ &z::RLR, 8, 0, 2 },
+	{ &z::RLR, 8, 0, 2 },
+	{ &z::RLR, 8, 0, 2 },
+	{ &z::RLR, 8, 0, 2 },
+	{ &z::RLR, 8, 0, 2 },
+	{ &z::RLR, 15, 0, 2 },
+	{ &z::RLR, 8, 0, 2 },
+	{ &z::RRR, 8, 0, 2 },
+	{ &z::RRR, 8, 0, 2 },
+	{ &z::RRR, 8, 0, 2 },
+	{ &z::RRR, 8, 0, 2 },
+	{ &z::RRR, 8, 0, 2 },
+	{ &z::RRR, 8, 0, 2 },
+	{ &z::RRR, 15, 0, 2 },
+	{ &z::RRR, 8, 0, 2 },
+	{ &z::SLAR, 8, 0, 2 },
+	{ &z::SLAR, 8, 0, 2 },
+	{ &z::SLAR, 8, 0, 2 },
+	{ &z::SLAR, 8, 0, 2 },
+	{ &z::SLAR, 8, 0, 2 },
+	{ &z::SLAR, 8, 0, 2 },
+	{ &z::SLAR, 15, 0, 2 },
+	{ &z::SLAR, 8, 0, 2 },
+	{ &z::SRAR, 8, 0, 2 },
+	{ &z::SRAR, 8, 0, 2 },
+	{ &z::SRAR, 8, 0, 2 },
+	{ &z::SRAR, 8, 0, 2 },
+	{ &z::SRAR, 8, 0, 2 },
+	{ &z::SRAR, 8, 0, 2 },
+	{ &z::SRAR, 15, 0, 2 },
+	{ &z::SRAR, 8, 0, 2 },
+	{ &z::SLLR, 8, 0, 2 },
+	{ &z::SLLR, 8, 0, 2 },
+	{ &z::SLLR, 8, 0, 2 },
+	{ &z::SLLR, 8, 0, 2 },
+	{ &z::SLLR, 8, 0, 2 },
+	{ &z::SLLR, 8, 0, 2 },
+	{ &z::SLLR, 15, 0, 2 },
+	{ &z::SLLR, 8, 0, 2 },
+	{ &z::SRLR, 8, 0, 2 },
+	{ &z::SRLR, 8, 0, 2 },
+	{ &z::SRLR, 8, 0, 2 },
+	{ &z::SRLR, 8, 0, 2 },
+	{ &z::SRLR, 8, 0, 2 },
+	{ &z::SRLR, 8, 0, 2 },
+	{ &z::SRLR, 15, 0, 2 },
+	{ &z::SRLR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 12, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 12, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 12, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 12, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 12, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 12, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 12, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::BITBR, 12, 0, 2 },
+	{ &z::BITBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 15, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 15, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 15, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 15, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 15, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 15, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 15, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::RESBR, 15, 0, 2 },
+	{ &z::RESBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 15, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 15, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 15, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 15, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 15, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 15, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 15, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+	{ &z::SETBR, 15, 0, 2 },
+	{ &z::SETBR, 8, 0, 2 },
+
+	//IX Instruction Set
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::ADDIXSS, 15, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::ADDIXSS, 15, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::LDDDNN, 14, 0, 4 },
+	{ &z::LDiNNIX, 20, 0, 4 },
+	{ &z::INCIX, 10, 0, 2 },
+	{ &z::INCR, 8, 0, 2 },
+	{ &z::DECR, 8, 0, 2 },
+	{ &z::LDRN, 11, 0, 3 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::ADDIXSS, 15, 0, 2 },
+	{ &z::LDIXiNN, 20, 0, 4 },
+	{ &z::DECIX, 10, 0, 2 },
+	{ &z::INCR, 8, 0, 2 },
+	{ &z::DECR, 8, 0, 2 },
+	{ &z::LDRN, 11, 0, 3 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INCR, 23, 0, 3 },
+	{ &z::DECR, 23, 0, 3 },
+	{ &z::LDRN, 19, 0, 4 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::ADDIXSS, 15, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRRi, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRRi, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRRi, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRRi, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRRi, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRRi, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDiRR, 19, 0, 3 },
+	{ &z::LDiRR, 19, 0, 3 },
+	{ &z::LDiRR, 19, 0, 3 },
+	{ &z::LDiRR, 19, 0, 3 },
+	{ &z::LDiRR, 19, 0, 3 },
+	{ &z::LDiRR, 19, 0, 3 },
+	{ &z::HALT, 8, 0, 2 },
+	{ &z::LDiRR, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRRi, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::ADDR, 8, 0, 2 },
+	{ &z::ADDR, 8, 0, 2 },
+	{ &z::ADDR, 8, 0, 2 },
+	{ &z::ADDR, 8, 0, 2 },
+	{ &z::ADDR, 8, 0, 2 },
+	{ &z::ADDR, 8, 0, 2 },
+	{ &z::ADDR, 19, 0, 3 },
+	{ &z::ADDR, 8, 0, 2 },
+	{ &z::ADCR, 8, 0, 2 },
+	{ &z::ADCR, 8, 0, 2 },
+	{ &z::ADCR, 8, 0, 2 },
+	{ &z::ADCR, 8, 0, 2 },
+	{ &z::ADCR, 8, 0, 2 },
+	{ &z::ADCR, 8, 0, 2 },
+	{ &z::ADCR, 19, 0, 3 },
+	{ &z::ADCR, 8, 0, 2 },
+	{ &z::SUBR, 8, 0, 2 },
+	{ &z::SUBR, 8, 0, 2 },
+	{ &z::SUBR, 8, 0, 2 },
+	{ &z::SUBR, 8, 0, 2 },
+	{ &z::SUBR, 8, 0, 2 },
+	{ &z::SUBR, 8, 0, 2 },
+	{ &z::SUBR, 19, 0, 3 },
+	{ &z::SUBR, 8, 0, 2 },
+	{ &z::SBCR, 8, 0, 2 },
+	{ &z::SBCR, 8, 0, 2 },
+	{ &z::SBCR, 8, 0, 2 },
+	{ &z::SBCR, 8, 0, 2 },
+	{ &z::SBCR, 8, 0, 2 },
+	{ &z::SBCR, 8, 0, 2 },
+	{ &z::SBCR, 19, 0, 3 },
+	{ &z::SBCR, 8, 0, 2 },
+	{ &z::ANDR, 8, 0, 2 },
+	{ &z::ANDR, 8, 0, 2 },
+	{ &z::ANDR, 8, 0, 2 },
+	{ &z::ANDR, 8, 0, 2 },
+	{ &z::ANDR, 8, 0, 2 },
+	{ &z::ANDR, 8, 0, 2 },
+	{ &z::ANDR, 19, 0, 3 },
+	{ &z::ANDR, 8, 0, 2 },
+	{ &z::XORR, 8, 0, 2 },
+	{ &z::XORR, 8, 0, 2 },
+	{ &z::XORR, 8, 0, 2 },
+	{ &z::XORR, 8, 0, 2 },
+	{ &z::XORR, 8, 0, 2 },
+	{ &z::XORR, 8, 0, 2 },
+	{ &z::XORR, 19, 0, 3 },
+	{ &z::XORR, 8, 0, 2 },
+	{ &z::ORR, 8, 0, 2 },
+	{ &z::ORR, 8, 0, 2 },
+	{ &z::ORR, 8, 0, 2 },
+	{ &z::ORR, 8, 0, 2 },
+	{ &z::ORR, 8, 0, 2 },
+	{ &z::ORR, 8, 0, 2 },
+	{ &z::ORR, 19, 0, 3 },
+	{ &z::ORR, 8, 0, 2 },
+	{ &z::CPR, 8, 0, 2 },
+	{ &z::CPR, 8, 0, 2 },
+	{ &z::CPR, 8, 0, 2 },
+	{ &z::CPR, 8, 0, 2 },
+	{ &z::CPR, 8, 0, 2 },
+	{ &z::CPR, 8, 0, 2 },
+	{ &z::CPR, 19, 0, 3 },
+	{ &z::CPR, 8, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::POPIX, 14, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::EXiSPIX, 23, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::PUSHIX, 15, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::JPiIX, 8, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::LDSPIX, 10, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+
+	//EXT Instruction Set
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INRiC, 12, 0, 2 },
+	{ &z::OUTiCR, 12, 0, 2 },
+	{ &z::SBCHLSS, 15, 0, 2 },
+	{ &z::LDiNNDD, 20, 0, 4 },
+	{ &z::NEG, 8, 0, 2 },
+	{ &z::RETN, 14, 0, 2 },
+	{ &z::IM0, 8, 0, 2 },
+	{ &z::LDIA, 9, 0, 2 },
+	{ &z::INRiC, 12, 0, 2 },
+	{ &z::OUTiCR, 12, 0, 2 },
+	{ &z::ADCHLSS, 15, 0, 2 },
+	{ &z::LDDDiNN, 20, 0, 4 },
+	{ &z::NEG, 8, 0, 2 },
+	{ &z::RETI, 14, 0, 2 },
+	{ &z::IM0, 8, 0, 2 },
+	{ &z::LDRA, 9, 0, 2 },
+	{ &z::INRiC, 12, 0, 2 },
+	{ &z::OUTiCR, 12, 0, 2 },
+	{ &z::SBCHLSS, 15, 0, 2 },
+	{ &z::LDiNNDD, 20, 0, 4 },
+	{ &z::NEG, 8, 0, 2 },
+	{ &z::RETN, 14, 0, 2 },
+	{ &z::IM1, 8, 0, 2 },
+	{ &z::LDAI, 9, 0, 2 },
+	{ &z::INRiC, 12, 0, 2 },
+	{ &z::OUTiCR, 12, 0, 2 },
+	{ &z::ADCHLSS, 15, 0, 2 },
+	{ &z::LDDDiNN, 20, 0, 4 },
+	{ &z::NEG, 8, 0, 2 },
+	{ &z::RETN, 14, 0, 2 },
+	{ &z::IM2, 8, 0, 2 },
+	{ &z::LDAR, 9, 0, 2 },
+	{ &z::INRiC, 12, 0, 2 },
+	{ &z::OUTiCR, 12, 0, 2 },
+	{ &z::SBCHLSS, 15, 0, 2 },
+	{ &z::LDiNNDD, 20, 0, 4 },
+	{ &z::NEG, 8, 0, 2 },
+	{ &z::RETN, 14, 0, 2 },
+	{ &z::IM0, 8, 0, 2 },
+	{ &z::RRD, 18, 0, 2 },
+	{ &z::INRiC, 12, 0, 2 },
+	{ &z::OUTiCR, 12, 0, 2 },
+	{ &z::ADCHLSS, 15, 0, 2 },
+	{ &z::LDDDiNN, 20, 0, 4 },
+	{ &z::NEG, 8, 0, 2 },
+	{ &z::RETN, 14, 0, 2 },
+	{ &z::IM0, 8, 0, 2 },
+	{ &z::RLD, 18, 0, 2 },
+	{ &z::INiC, 12, 0, 2 },
+	{ &z::OUTiC0, 12, 0, 2 },
+	{ &z::SBCHLSS, 15, 0, 2 },
+	{ &z::LDiNNDD, 20, 0, 4 },
+	{ &z::NEG, 8, 0, 2 },
+	{ &z::RETN, 14, 0, 2 },
+	{ &z::IM1, 8, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INRiC, 12, 0, 2 },
+	{ &z::OUTiCR, 12, 0, 2 },
+	{ &z::ADCHLSS, 15, 0, 2 },
+	{ &z::LDDDiNN, 40, 0, 4 },
+	{ &z::NEG, 8, 0, 2 },
+	{ &z::RETN, 14, 0, 2 },
+	{ &z::IM2, 8, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::LDI, 16, 0, 2 },
+	{ &z::CPI, 16, 0, 2 },
+	{ &z::INI, 16, 0, 2 },
+	{ &z::OUTI, 16, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::LDD, 16, 0, 2 },
+	{ &z::CPD, 16, 0, 2 },
+	{ &z::IND, 16, 0, 2 },
+	{ &z::OUTD, 16, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::LDIR, 21, 16, 2 },
+	{ &z::CPIR, 21, 16, 2 },
+	{ &z::INIR, 21, 16, 2 },
+	{ &z::OTIR, 21, 16, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::LDDR, 21, 16, 2 },
+	{ &z::CPDR, 21, 16, 2 },
+	{ &z::INDR, 21, 16, 2 },
+	{ &z::OTDR, 21, 16, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+
+	//IY Instruction Set
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::ADDIYSS, 15, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::ADDIYSS, 15, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::LDDDNN, 14, 0, 4 },
+	{ &z::LDiNNIY, 20, 0, 4 },
+	{ &z::INCIY, 10, 0, 2 },
+	{ &z::INCR, 8, 0, 2 },
+	{ &z::DECR, 8, 0, 2 },
+	{ &z::LDRN, 11, 0, 3 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::ADDIYSS, 15, 0, 2 },
+	{ &z::LDIYiNN, 20, 0, 4 },
+	{ &z::DECIY, 10, 0, 2 },
+	{ &z::INCR, 8, 0, 2 },
+	{ &z::DECR, 8, 0, 2 },
+	{ &z::LDRN, 11, 0, 3 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INCR, 23, 0, 3 },
+	{ &z::DECR, 23, 0, 3 },
+	{ &z::LDRN, 19, 0, 4 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::ADDIYSS, 15, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRRi, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRRi, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRRi, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRRi, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRRi, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRRi, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDiRR, 19, 0, 3 },
+	{ &z::LDiRR, 19, 0, 3 },
+	{ &z::LDiRR, 19, 0, 3 },
+	{ &z::LDiRR, 19, 0, 3 },
+	{ &z::LDiRR, 19, 0, 3 },
+	{ &z::LDiRR, 19, 0, 3 },
+	{ &z::HALT, 8, 0, 2 },
+	{ &z::LDiRR, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::LDRRi, 19, 0, 3 },
+	{ &z::LDRR, 8, 0, 2 },
+	{ &z::ADDR, 8, 0, 2 },
+	{ &z::ADDR, 8, 0, 2 },
+	{ &z::ADDR, 8, 0, 2 },
+	{ &z::ADDR, 8, 0, 2 },
+	{ &z::ADDR, 8, 0, 2 },
+	{ &z::ADDR, 8, 0, 2 },
+	{ &z::ADDR, 19, 0, 3 },
+	{ &z::ADDR, 8, 0, 2 },
+	{ &z::ADCR, 8, 0, 2 },
+	{ &z::ADCR, 8, 0, 2 },
+	{ &z::ADCR, 8, 0, 2 },
+	{ &z::ADCR, 8, 0, 2 },
+	{ &z::ADCR, 8, 0, 2 },
+	{ &z::ADCR, 8, 0, 2 },
+	{ &z::ADCR, 19, 0, 3 },
+	{ &z::ADCR, 8, 0, 2 },
+	{ &z::SUBR, 8, 0, 2 },
+	{ &z::SUBR, 8, 0, 2 },
+	{ &z::SUBR, 8, 0, 2 },
+	{ &z::SUBR, 8, 0, 2 },
+	{ &z::SUBR, 8, 0, 2 },
+	{ &z::SUBR, 8, 0, 2 },
+	{ &z::SUBR, 19, 0, 3 },
+	{ &z::SUBR, 8, 0, 2 },
+	{ &z::SBCR, 8, 0, 2 },
+	{ &z::SBCR, 8, 0, 2 },
+	{ &z::SBCR, 8, 0, 2 },
+	{ &z::SBCR, 8, 0, 2 },
+	{ &z::SBCR, 8, 0, 2 },
+	{ &z::SBCR, 8, 0, 2 },
+	{ &z::SBCR, 19, 0, 3 },
+	{ &z::SBCR, 8, 0, 2 },
+	{ &z::ANDR, 8, 0, 2 },
+	{ &z::ANDR, 8, 0, 2 },
+	{ &z::ANDR, 8, 0, 2 },
+	{ &z::ANDR, 8, 0, 2 },
+	{ &z::ANDR, 8, 0, 2 },
+	{ &z::ANDR, 8, 0, 2 },
+	{ &z::ANDR, 19, 0, 3 },
+	{ &z::ANDR, 8, 0, 2 },
+	{ &z::XORR, 8, 0, 2 },
+	{ &z::XORR, 8, 0, 2 },
+	{ &z::XORR, 8, 0, 2 },
+	{ &z::XORR, 8, 0, 2 },
+	{ &z::XORR, 8, 0, 2 },
+	{ &z::XORR, 8, 0, 2 },
+	{ &z::XORR, 19, 0, 3 },
+	{ &z::XORR, 8, 0, 2 },
+	{ &z::ORR, 8, 0, 2 },
+	{ &z::ORR, 8, 0, 2 },
+	{ &z::ORR, 8, 0, 2 },
+	{ &z::ORR, 8, 0, 2 },
+	{ &z::ORR, 8, 0, 2 },
+	{ &z::ORR, 8, 0, 2 },
+	{ &z::ORR, 19, 0, 3 },
+	{ &z::ORR, 8, 0, 2 },
+	{ &z::CPR, 8, 0, 2 },
+	{ &z::CPR, 8, 0, 2 },
+	{ &z::CPR, 8, 0, 2 },
+	{ &z::CPR, 8, 0, 2 },
+	{ &z::CPR, 8, 0, 2 },
+	{ &z::CPR, 8, 0, 2 },
+	{ &z::CPR, 19, 0, 3 },
+	{ &z::CPR, 8, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::POPIY, 14, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::EXiSPIY, 23, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::PUSHIY, 15, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::JPiIY, 8, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::LDSPIY, 10, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+	{ &z::INVAL, 0, 0, 2 },
+
+	//IX BIT Instruction Set
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RLCR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RRCR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RLR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RRR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SLAR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SRAR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SLLR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SRLR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+
+	//IY BIT Instruction Set
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RLCR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RRCR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RLR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RRR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SLAR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SRAR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SLLR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SRLR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::BITBR, 20, 0, 4 },
+	{ &z::UNDOC, 20, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::RESBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 },
+	{ &z::SETBR, 23, 0, 4 },
+	{ &z::UNDOC, 23, 0, 4 }
+};
+
+//Instruction Mnemonics - Cold Table used only by disassemble(), same indexing as instSet
+constexpr const char* const Z80A::instName[0x700] =
+{
+	//MAIN Instruction Set
+	"NOP ",
+	"LD BC,0xhhll",
+	"LD (BC),A",
+	"INC BC",
+	"INC B",
+	"DEC B",
+	"LD B,0xll",
+	"RLCA ",
+	"EX AF,AF'",
+	"ADD HL,BC",
+	"LD A,(BC)",
+	"DEC BC",
+	"INC C",
+	"DEC C",
+	"LD C,0xll",
+	"RRCA ",
+	"DJNZ 0xll",
+	"LD DE,0xhhll",
+	"LD (DE),A",
+	"INC DE",
+	"INC D",
+	"DEC D",
+	"LD D,0xll",
+	"RLA ",
+	"JR 0xll",
+	"ADD HL,DE",
+	"LD A,(DE)",
+	"DEC DE",
+	"INC E",
+	"DEC E",
+	"LD E,0xll",
+	"RRA ",
+	"JR NZ 0xll",
+	"LD HL,0xhhll",
+	"LD (0xhhll),HL",
+	"INC HL",
+	"INC H",
+	"DEC H",
+	"LD H,0xll",
+	"DAA ",
+	"JR Z 0xll",
+	"ADD HL,HL",
+	"LD HL,(0xhhll)",
+	"DEC HL",
+	"INC L",
+	"DEC L",
+	"LD L,0xll",
+	"CPL ",
+	"JR NC 0xll",
+	"LD SP,0xhhll",
+	"LD (0xhhll),A",
+	"INC SP",
+	"INC (HL)",
+	"DEC (HL)",
+	"LD (HL),0xll",
+	"SCF ",
+	"JR C 0xll",
+	"ADD HL,SP",
+	"LD A,(0xhhll)",
+	"DEC SP",
+	"INC A",
+	"DEC A",
+	"LD A,0xll",
+	"CCF ",
+	"LD B,B",
+	"LD B,C",
+	"LD B,D",
+	"LD B,E",
+	"LD B,H",
+	"LD B,L",
+	"LD B,(HL)",
+	"LD B,A",
+	"LD C,B",
+	"LD C,C",
+	"LD C,D",
+	"LD C,E",
+	"LD C,H",
+	"LD C,L",
+	"LD C,(HL)",
+	"LD C,A",
+	"LD D,B",
+	"LD D,C",
+	"LD D,D",
+	"LD D,E",
+	"LD D,H",
+	"LD D,L",
+	"LD D,(HL)",
+	"LD D,A",
+	"LD E,B",
+	"LD E,C",
+	"LD E,D",
+	"LD E,E",
+	"LD E,H",
+	"LD E,L",
+	"LD E,(HL)",
+	"LD E,A",
+	"LD H,B",
+	"LD H,C",
+	"LD H,D",
+	"LD H,E",
+	"LD H,H",
+	"LD H,L",
+	"LD H,(HL)",
+	"LD H,A",
+	"LD L,B",
+	"LD L,C",
+	"LD L,D",
+	"LD L,E",
+	"LD L,H",
+	"LD L,L",
+	"LD L,(HL)",
+	"LD L,A",
+	"LD (HL),B",
+	"LD (HL),C",
+	"LD (HL),D",
+	"LD (HL),E",
+	"LD (HL),H",
+	"LD (HL),L",
+	"HALT ",
+	"LD (HL),A",
+	"LD A,B",
+	"LD A,C",
+	"LD A,D",
+	"LD A,E",
+	"LD A,H",
+	"LD A,L",
+	"LD A,(HL)",
+	"LD A,A",
+	"ADD A,B",
+	"ADD A,C",
+	"ADD A,D",
+	"ADD A,E",
+	"ADD A,H",
+	"ADD A,L",
+	"ADD A,(HL)",
+	"ADD A,A",
+	"ADC A,B",
+	"ADC A,C",
+	"ADC A,D",
+	"ADC A,E",
+	"ADC A,H",
+	"ADC A,L",
+	"ADC A,(HL)",
+	"ADC A,A",
+	"SUB A,B",
+	"SUB A,C",
+	"SUB A,D",
+	"SUB A,E",
+	"SUB A,H",
+	"SUB A,L",
+	"SUB A,(HL)",
+	"SUB A,A",
+	"SBC A,B",
+	"SBC A,C",
+	"SBC A,D",
+	"SBC A,E",
+	"SBC A,H",
+	"SBC A,L",
+	"SBC A,(HL)",
+	"SBC A,A",
+	"AND B",
+	"AND C",
+	"AND D",
+	"AND E",
+	"AND H",
+	"AND L",
+	"AND (HL)",
+	"AND A",
+	"XOR B",
+	"XOR C",
+	"XOR D",
+	"XOR E",
+	"XOR H",
+	"XOR L",
+	"XOR (HL)",
+	"XOR A",
+	"OR B",
+	"OR C",
+	"OR D",
+	"OR E",
+	"OR H",
+	"OR L",
+	"OR (HL)",
+	"OR A",
+	"CP B",
+	"CP C",
+	"CP D",
+	"CP E",
+	"CP H",
+	"CP L",
+	"CP (HL)",
+	"CP A",
+	"RET NZ ",
+	"POP BC",
+	"JP NZ 0xhhll",
+	"JP 0xhhll",
+	"CALL NZ 0xhhll",
+	"PUSH BC",
+	"ADD A,0xll",
+	"RST 00h",
+	"RET Z ",
+	"RET ",
+	"JP Z 0xhhll",
+	"XXX",
+	"CALL Z 0xhhll",
+	"CALL 0xhhll",
+	"ADC A,0xll",
+	"RST 08h",
+	"RET NC ",
+	"POP DE",
+	"JP NC 0xhhll",
+	"OUT (0xll),A",
+	"CALL NC 0xhhll",
+	"PUSH DE",
+	"SUB A,0xll",
+	"RST 10h",
+	"RET C ",
+	"EXX ",
+	"JP C 0xhhll",
+	"IN A,(0xll)",
+	"CALL C 0xhhll",
+	"XXX",
+	"SBC A,0xll",
+	"RST 18h",
+	"RET PO ",
+	"POP HL",
+	"JP PO 0xhhll",
+	"EX (SP),HL",
+	"CALL PO 0xhhll",
+	"PUSH HL",
+	"AND 0xll",
+	"RST 20h",
+	"RET PE ",
+	"JP (HL)",
+	"JP PE 0xhhll",
+	"EX DE,HL",
+	"CALL PE 0xhhll",
+	"XXX",
+	"XOR 0xll",
+	"RST 28h",
+	"RET P ",
+	"POP AF",
+	"JP P 0xhhll",
+	"DI ",
+	"CALL P 0xhhll",
+	"PUSH AF",
+	"OR 0xll",
+	"RST 30h",
+	"RET M ",
+	"LD SP,HL",
+	"JP M 0xhhll",
+	"EI ",
+	"CALL M 0xhhll",
+	"XXX",
+	"CP 0xll",
+	"RST 38h",
+
+	//BIT Instruction Set
+	"RLC B",
+	"RLC C",
+	"RLC D",
+	"RLC E",
+	"RLC H",
+	"RLC L",
+	"RLC (HL)",
+	"RLC A",
+	"RRC B",
+	"RRC C",
+	"RRC D",
+	"RRC E",
+	"RRC H",
+	"RRC L",
+	"RRC (HL)",
+	"RRC A",
+	"RL B",
+	"RL C",
+	"RL D",
+	"RL E",
+	"RL H",
+	"RL L",
+	"RL (HL)",
+	"RL A",
+	"RR B",
+	"RR C",
+	"RR D",
+	"RR E",
+	"RR H",
+	"RR L",
+	"RR (HL)",
+	"RR A",
+	"SLA B",
+	"SLA C",
+	"SLA D",
+	"SLA E",
+	"SLA H",
+	"SLA L",
+	"SLA (HL)",
+	"SLA A",
+	"SRA B",
+	"SRA C",
+	"SRA D",
+	"SRA E",
+	"SRA H",
+	"SRA L",
+	"SRA (HL)",
+	"SRA A",
+	"SLL B",
+	"SLL C",
+	"SLL D",
+	"SLL E",
+	"SLL H",
+	"SLL L",
+	"SLL (HL)",
+	"SLL A",
+	"SRL B",
+	"SRL C",
+	"SRL D",
+	"SRL E",
+	"SRL H",
+	"SRL L",
+	"SRL (HL)",
+	"SRL A",
+	"BIT 0,B",
+	"BIT 0,C",
+	"BIT 0,D",
+	"BIT 0,E",
+	"BIT 0,H",
+	"BIT 0,L",
+	"BIT 0,(HL)",
+	"BIT 0,A",
+	"BIT 1,B",
+	"BIT 1,C",
+	"BIT 1,D",
+	"BIT 1,E",
+	"BIT 1,H",
+	"BIT 1,L",
+	"BIT 1,(HL)",
+	"BIT 1,A",
+	"BIT 2,B",
+	"BIT 2,C",
+	"BIT 2,D",
+	"BIT 2,E",
+	"BIT 2,H",
+	"BIT 2,L",
+	"BIT 2,(HL)",
+	"BIT 2,A",
+	"BIT 3,B",
+	"BIT 3,C",
+	"BIT 3,D",
+	"BIT 3,E",
+	"BIT 3,H",
+	"BIT 3,L",
+	"BIT 3,(HL)",
+	"BIT 3,A",
+	"BIT 4,B",
+	"BIT 4,C",
+	"BIT 4,D",
+	"BIT 4,E",
+	"BIT 4,H",
+	"BIT 4,L",
+	"BIT 4,(HL)",
+	"BIT 4,A",
+	"BIT 5,B",
+	"BIT 5,C",
+	"BIT 5,D",
+	"BIT 5,E",
+	"BIT 5,H",
+	"BIT 5,L",
+	"BIT 5,(HL)",
+	"BIT 5,A",
+	"BIT 6,B",
+	"BIT 6,C",
+	"BIT 6,D",
+	"BIT 6,E",
+	"BIT 6,H",
+	"BIT 6,L",
+	"BIT 6,(HL)",
+	"BIT 6,A",
+	"BIT 7,B",
+	"BIT 7,C",
+	"BIT 7,D",
+	"BIT 7,E",
+	"BIT 7,H",
+	"BIT 7,L",
+	"BIT 7,(HL)",
+	"BIT 7,A",
+	"RES 0,B",
+	"RES 0,C",
+	"RES 0,D",
+	"RES 0,E",
+	"RES 0,H",
+	"RES 0,L",
+	"RES 0,(HL)",
+	"RES 0,A",
+	"RES 1,B",
+	"RES 1,C",
+	"RES 1,D",
+	"RES 1,E",
+	"RES 1,H",
+	"RES 1,L",
+	"RES 1,(HL)",
+	"RES 1,A",
+	"RES 2,B",
+	"RES 2,C",
+	"RES 2,D",
+	"RES 2,E",
+	"RES 2,H",
+	"RES 2,L",
+	"RES 2,(HL)",
+	"RES 2,A",
+	"RES 3,B",
+	"RES 3,C",
+	"RES 3,D",
+	"RES 3,E",
+	"RES 3,H",
+	"RES 3,L",
+	"RES 3,(HL)",
+	"RES 3,A",
+	"RES 4,B",
+	"RES 4,C",
+	"RES 4,D",
+	"RES 4,E",
+	"RES 4,H",
+	"RES 4,L",
+	"RES 4,(HL)",
+	"RES 4,A",
+	"RES 5,B",
+	"RES 5,C",
+	"RES 5,D",
+	"RES 5,E",
+	"RES 5,H",
+	"RES 5,L",
+	"RES 5,(HL)",
+	"RES 5,A",
+	"RES 6,B",
+	"RES 6,C",
+	"RES 6,D",
+	"RES 6,E",
+	"RES 6,H",
+	"RES 6,L",
+	"RES 6,(HL)",
+	"RES 6,A",
+	"RES 7,B",
+	"RES 7,C",
+	"RES 7,D",
+	"RES 7,E",
+	"RES 7,H",
+	"RES 7,L",
+	"RES 7,(HL)",
+	"RES 7,A",
+	"SET 0,B",
+	"SET 0,C",
+	"SET 0,D",
+	"SET 0,E",
+	"SET 0,H",
+	"SET 0,L",
+	"SET 0,(HL)",
+	"SET 0,A",
+	"SET 1,B",
+	"SET 1,C",
+	"SET 1,D",
+	"SET 1,E",
+	"SET 1,H",
+	"SET 1,L",
+	"SET 1,(HL)",
+	"SET 1,A",
+	"SET 2,B",
+	"SET 2,C",
+	"SET 2,D",
+	"SET 2,E",
+	"SET 2,H",
+	"SET 2,L",
+	"SET 2,(HL)",
+	"SET 2,A",
+	"SET 3,B",
+	"SET 3,C",
+	"SET 3,D",
+	"SET 3,E",
+	"SET 3,H",
+	"SET 3,L",
+	"SET 3,(HL)",
+	"SET 3,A",
+	"SET 4,B",
+	"SET 4,C",
+	"SET 4,D",
+	"SET 4,E",
+	"SET 4,H",
+	"SET 4,L",
+	"SET 4,(HL)",
+	"SET 4,A",
+	"SET 5,B",
+	"SET 5,C",
+	"SET 5,D",
+	"SET 5,E",
+	"SET 5,H",
+	"SET 5,L",
+	"SET 5,(HL)",
+	"SET 5,A",
+	"SET 6,B",
+	"SET 6,C",
+	"SET 6,D",
+	"SET 6,E",
+	"SET 6,H",
+	"SET 6,L",
+	"SET 6,(HL)",
+	"SET 6,A",
+	"SET 7,B",
+	"SET 7,C",
+	"SET 7,D",
+	"SET 7,E",
+	"SET 7,H",
+	"SET 7,L",
+	"SET 7,(HL)",
+	"SET 7,A",
+
+	//IX Instruction Set
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"ADD IX,BC",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"ADD IX,DE",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"LD IX,0xhhll",
+	"LD (0xhhll),IX",
+	"INC IX",
+	"INC IXH",
+	"DEC IXH",
+	"LD IXH,0xll",
+	"XXX ",
+	"XXX ",
+	"ADD IX,IX",
+	"LD IX,(0xhhll)",
+	"DEC IX",
+	"INC IXL",
+	"DEC IXL",
+	"LD IXL,0xll",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"INC (IX+0xll)",
+	"DEC (IX+0xll)",
+	"LD (IX+0xll),0xhh",
+	"XXX ",
+	"XXX ",
+	"ADD IX,SP",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"LD B,B",
+	"LD B,C",
+	"LD B,D",
+	"LD B,E",
+	"LD B,IXH",
+	"LD B,IXL",
+	"LD B,(IX+0xll)",
+	"LD B,A",
+	"LD C,B",
+	"LD C,C",
+	"LD C,D",
+	"LD C,E",
+	"LD C,IXH",
+	"LD C,IXL",
+	"LD C,(IX+0xll)",
+	"LD C,A",
+	"LD D,B",
+	"LD D,C",
+	"LD D,D",
+	"LD D,E",
+	"LD D,IXH",
+	"LD D,IXL",
+	"LD D,(IX+0xll)",
+	"LD D,A",
+	"LD E,B",
+	"LD E,C",
+	"LD E,D",
+	"LD E,E",
+	"LD E,IXH",
+	"LD E,IXL",
+	"LD E,(IX+0xll)",
+	"LD E,A",
+	"LD IXH,B",
+	"LD IXH,C",
+	"LD IXH,D",
+	"LD IXH,E",
+	"LD IXH,IXH",
+	"LD IXH,IXL",
+	"LD H,(IX+0xll)",
+	"LD IXH,A",
+	"LD IXL,B",
+	"LD IXL,C",
+	"LD IXL,D",
+	"LD IXL,E",
+	"LD IXL,IXH",
+	"LD IXL,IXL",
+	"LD L,(IX+0xll)",
+	"LD IXL,A",
+	"LD (IX+0xll),B",
+	"LD (IX+0xll),C",
+	"LD (IX+0xll),D",
+	"LD (IX+0xll),E",
+	"LD (IX+0xll),H",
+	"LD (IX+0xll),L",
+	"HALT ",
+	"LD (IX+0xll),A",
+	"LD A,B",
+	"LD A,C",
+	"LD A,D",
+	"LD A,E",
+	"LD A,IXH",
+	"LD A,IXL",
+	"LD A,(IX+0xll)",
+	"LD A,A",
+	"ADD A,B",
+	"ADD A,C",
+	"ADD A,D",
+	"ADD A,E",
+	"ADD A,IXH",
+	"ADD A,IXL",
+	"ADD A,(IX+0xll)",
+	"ADD A,A",
+	"ADC A,B",
+	"ADC A,C",
+	"ADC A,D",
+	"ADC A,E",
+	"ADC A,IXH",
+	"ADC A,IXL",
+	"ADC A,(IX+0xll)",
+	"ADC A,A",
+	"SUB A,B",
+	"SUB A,C",
+	"SUB A,D",
+	"SUB A,E",
+	"SUB A,IXH",
+	"SUB A,IXL",
+	"SUB A,(IX+0xll)",
+	"SUB A,A",
+	"SBC A,B",
+	"SBC A,C",
+	"SBC A,D",
+	"SBC A,E",
+	"SBC A,IXH",
+	"SBC A,IXL",
+	"SBC A,(IX+0xll)",
+	"SBC A,A",
+	"AND B",
+	"AND C",
+	"AND D",
+	"AND E",
+	"AND IXH",
+	"AND IXL",
+	"AND (IX+0xll)",
+	"AND A",
+	"XOR B",
+	"XOR C",
+	"XOR D",
+	"XOR E",
+	"XOR IXH",
+	"XOR IXL",
+	"XOR (IX+0xll)",
+	"XOR A",
+	"OR B",
+	"OR C",
+	"OR D",
+	"OR E",
+	"OR IXH",
+	"OR IXL",
+	"OR (IX+0xll)",
+	"OR A",
+	"CP B",
+	"CP C",
+	"CP D",
+	"CP E",
+	"CP IXH",
+	"CP IXL",
+	"CP (IX+0xll)",
+	"CP A",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"POP IX",
+	"XXX ",
+	"EX (SP),IX",
+	"XXX ",
+	"PUSH IX",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"JP (IX)",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"LD SP,IX",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+
+	//EXT Instruction Set
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"IN B,(C)",
+	"OUT (C),B",
+	"SBC HL,BC",
+	"LD (0xhhll),BC",
+	"NEG ",
+	"RETN ",
+	"IM 0 ",
+	"LD I,A",
+	"IN C,(C)",
+	"OUT (C),C",
+	"ADC HL,BC",
+	"LD BC,(0xhhll)",
+	"NEG ",
+	"RETI ",
+	"IM 0",
+	"LD R,A",
+	"IN D,(C)",
+	"OUT (C),D",
+	"SBC HL,DE",
+	"LD (0xhhll),DE",
+	"NEG ",
+	"RETN ",
+	"IM 1 ",
+	"LD A,I",
+	"IN E,(C)",
+	"OUT (C),E",
+	"ADC HL,DE",
+	"LD DE,(0xhhll)",
+	"NEG ",
+	"RETN ",
+	"IM 2 ",
+	"LD A,R",
+	"IN H,(C)",
+	"OUT (C),H",
+	"SBC HL,HL",
+	"LD (0xhhll),HL",
+	"NEG ",
+	"RETN ",
+	"IM 0 ",
+	"RRD ",
+	"IN L,(C)",
+	"OUT (C),L",
+	"ADC HL,HL",
+	"LD HL,(0xhhll)",
+	"NEG ",
+	"RETN ",
+	"IM 0",
+	"RLD ",
+	"IN (C)",
+	"OUT (C),0",
+	"SBC HL,SP",
+	"LD (0xhhll),SP",
+	"NEG ",
+	"RETN ",
+	"IM 1 ",
+	"XXX ",
+	"IN A,(C)",
+	"OUT (C),A",
+	"ADC HL,SP",
+	"LD SP,(0xhhll)",
+	"NEG ",
+	"RETN ",
+	"IM 2 ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"LDI ",
+	"CPI ",
+	"INI ",
+	"OUTI ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"LDD ",
+	"CPD ",
+	"IND ",
+	"OUTD ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"LDIR ",
+	"CPIR ",
+	"INIR ",
+	"OTIR ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"LDDR ",
+	"CPDR ",
+	"INDR ",
+	"OTDR ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+
+	//IY Instruction Set
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"ADD IY,BC",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"ADD IY,DE",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"LD IY,0xhhll",
+	"LD (0xhhll),IY",
+	"INC IY",
+	"INC IYH",
+	"DEC IYH",
+	"LD IYH,0xll",
+	"XXX ",
+	"XXX ",
+	"ADD IY,IY",
+	"LD IY,(0xhhll)",
+	"DEC IY",
+	"INC IYL",
+	"DEC IYL",
+	"LD IYL,0xll",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"INC (IY+0xll)",
+	"DEC (IY+0xll)",
+	"LD (IY+0xll),0xhh",
+	"XXX ",
+	"XXX ",
+	"ADD IY,SP",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"LD B,B",
+	"LD B,C",
+	"LD B,D",
+	"LD B,E",
+	"LD B,IYH",
+	"LD B,IYL",
+	"LD B,(IY+0xll)",
+	"LD B,A",
+	"LD C,B",
+	"LD C,C",
+	"LD C,D",
+	"LD C,E",
+	"LD C,IYH",
+	"LD C,IYL",
+	"LD C,(IY+0xll)",
+	"LD C,A",
+	"LD D,B",
+	"LD D,C",
+	"LD D,D",
+	"LD D,E",
+	"LD D,IYH",
+	"LD D,IYL",
+	"LD D,(IY+0xll)",
+	"LD D,A",
+	"LD E,B",
+	"LD E,C",
+	"LD E,D",
+	"LD E,E",
+	"LD E,IYH",
+	"LD E,IYL",
+	"LD E,(IY+0xll)",
+	"LD E,A",
+	"LD IYH,B",
+	"LD IYH,C",
+	"LD IYH,D",
+	"LD IYH,E",
+	"LD IYH,IYH",
+	"LD IYH,IYL",
+	"LD H,(IY+0xll)",
+	"LD IYH,A",
+	"LD IYL,B",
+	"LD IYL,C",
+	"LD IYL,D",
+	"LD IYL,E",
+	"LD IYL,IYH",
+	"LD IYL,IYL",
+	"LD L,(IY+0xll)",
+	"LD IYL,A",
+	"LD (IY+0xll),B",
+	"LD (IY+0xll),C",
+	"LD (IY+0xll),D",
+	"LD (IY+0xll),E",
+	"LD (IY+0xll),H",
+	"LD (IY+0xll),L",
+	"HALT ",
+	"LD (IY+0xll),A",
+	"LD A,B",
+	"LD A,C",
+	"LD A,D",
+	"LD A,E",
+	"LD A,IYH",
+	"LD A,IYL",
+	"LD A,(IY+0xll)",
+	"LD A,A",
+	"ADD A,B",
+	"ADD A,C",
+	"ADD A,D",
+	"ADD A,E",
+	"ADD A,IYH",
+	"ADD A,IYL",
+	"ADD A,(IY+0xll)",
+	"ADD A,A",
+	"ADC A,B",
+	"ADC A,C",
+	"ADC A,D",
+	"ADC A,E",
+	"ADC A,IYH",
+	"ADC A,IYL",
+	"ADC A,(IY+0xll)",
+	"ADC A,A",
+	"SUB A,B",
+	"SUB A,C",
+	"SUB A,D",
+	"SUB A,E",
+	"SUB A,IYH",
+	"SUB A,IYL",
+	"SUB A,(IY+0xll)",
+	"SUB A,A",
+	"SBC A,B",
+	"SBC A,C",
+	"SBC A,D",
+	"SBC A,E",
+	"SBC A,IYH",
+	"SBC A,IYL",
+	"SBC A,(IY+0xll)",
+	"SBC A,A",
+	"AND B",
+	"AND C",
+	"AND D",
+	"AND E",
+	"AND IYH",
+	"AND IYL",
+	"AND (IY+0xll)",
+	"AND A",
+	"XOR B",
+	"XOR C",
+	"XOR D",
+	"XOR E",
+	"XOR IYH",
+	"XOR IYL",
+	"XOR (IY+0xll)",
+	"XOR A",
+	"OR B",
+	"OR C",
+	"OR D",
+	"OR E",
+	"OR IYH",
+	"OR IYL",
+	"OR (IY+0xll)",
+	"OR A",
+	"CP B",
+	"CP C",
+	"CP D",
+	"CP E",
+	"CP IYH",
+	"CP IYL",
+	"CP (IY+0xll)",
+	"CP A",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"POP IY",
+	"XXX ",
+	"EX (SP),IY",
+	"XXX ",
+	"PUSH IY",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"JP (IY)",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"LD SP,IY",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+	"XXX ",
+
+	//IX BIT Instruction Set
+	"RLC (IX+0xll),B",
+	"RLC (IX+0xll),C",
+	"RLC (IX+0xll),D",
+	"RLC (IX+0xll),E",
+	"RLC (IX+0xll),H",
+	"RLC (IX+0xll),L",
+	"RLC (IX+0xll)",
+	"RLC (IX+0xll),A",
+	"RRC (IX+0xll),B",
+	"RRC (IX+0xll),C",
+	"RRC (IX+0xll),D",
+	"RRC (IX+0xll),E",
+	"RRC (IX+0xll),H",
+	"RRC (IX+0xll),L",
+	"RRC (IX+0xll)",
+	"RRC (IX+0xll),A",
+	"RL (IX+0xll),B",
+	"RL (IX+0xll),C",
+	"RL (IX+0xll),D",
+	"RL (IX+0xll),E",
+	"RL (IX+0xll),H",
+	"RL (IX+0xll),L",
+	"RL (IX+0xll)",
+	"RL (IX+0xll),A",
+	"RR (IX+0xll),B",
+	"RR (IX+0xll),C",
+	"RR (IX+0xll),D",
+	"RR (IX+0xll),E",
+	"RR (IX+0xll),H",
+	"RR (IX+0xll),L",
+	"RR (IX+0xll)",
+	"RR (IX+0xll),A",
+	"SLA (IX+0xll),B",
+	"SLA (IX+0xll),C",
+	"SLA (IX+0xll),D",
+	"SLA (IX+0xll),E",
+	"SLA (IX+0xll),H",
+	"SLA (IX+0xll),L",
+	"SLA (IX+0xll)",
+	"SLA (IX+0xll),A",
+	"SRA (IX+0xll),B",
+	"SRA (IX+0xll),C",
+	"SRA (IX+0xll),D",
+	"SRA (IX+0xll),E",
+	"SRA (IX+0xll),H",
+	"SRA (IX+0xll),L",
+	"SRA (IX+0xll)",
+	"SRA (IX+0xll),A",
+	"SLL (IX+0xll),B",
+	"SLL (IX+0xll),C",
+	"SLL (IX+0xll),D",
+	"SLL (IX+0xll),E",
+	"SLL (IX+0xll),H",
+	"SLL (IX+0xll),L",
+	"SLL (IX+0xll)",
+	"SLL (IX+0xll),A",
+	"SRL (IX+0xll),B",
+	"SRL (IX+0xll),C",
+	"SRL (IX+0xll),D",
+	"SRL (IX+0xll),E",
+	"SRL (IX+0xll),H",
+	"SRL (IX+0xll),L",
+	"SRL (IX+0xll)",
+	"SRL (IX+0xll),A",
+	"BIT 0,(IX+0xll),B",
+	"BIT 0,(IX+0xll),C",
+	"BIT 0,(IX+0xll),D",
+	"BIT 0,(IX+0xll),E",
+	"BIT 0,(IX+0xll),H",
+	"BIT 0,(IX+0xll),L",
+	"BIT 0,(IX+0xll)",
+	"BIT 0,(IX+0xll),A",
+	"BIT 1,(IX+0xll),B",
+	"BIT 1,(IX+0xll),C",
+	"BIT 1,(IX+0xll),D",
+	"BIT 1,(IX+0xll),E",
+	"BIT 1,(IX+0xll),H",
+	"BIT 1,(IX+0xll),L",
+	"BIT 1,(IX+0xll)",
+	"BIT 1,(IX+0xll),A",
+	"BIT 2,(IX+0xll),B",
+	"BIT 2,(IX+0xll),C",
+	"BIT 2,(IX+0xll),D",
+	"BIT 2,(IX+0xll),E",
+	"BIT 2,(IX+0xll),H",
+	"BIT 2,(IX+0xll),L",
+	"BIT 2,(IX+0xll)",
+	"BIT 2,(IX+0xll),A",
+	"BIT 3,(IX+0xll),B",
+	"BIT 3,(IX+0xll),C",
+	"BIT 3,(IX+0xll),D",
+	"BIT 3,(IX+0xll),E",
+	"BIT 3,(IX+0xll),H",
+	"BIT 3,(IX+0xll),L",
+	"BIT 3,(IX+0xll)",
+	"BIT 3,(IX+0xll),A",
+	"BIT 4,(IX+0xll),B",
+	"BIT 4,(IX+0xll),C",
+	"BIT 4,(IX+0xll),D",
+	"BIT 4,(IX+0xll),E",
+	"BIT 4,(IX+0xll),H",
+	"BIT 4,(IX+0xll),L",
+	"BIT 4,(IX+0xll)",
+	"BIT 4,(IX+0xll),A",
+	"BIT 5,(IX+0xll),B",
+	"BIT 5,(IX+0xll),C",
+	"BIT 5,(IX+0xll),D",
+	"BIT 5,(IX+0xll),E",
+	"BIT 5,(IX+0xll),H",
+	"BIT 5,(IX+0xll),L",
+	"BIT 5,(IX+0xll)",
+	"BIT 5,(IX+0xll),A",
+	"BIT 6,(IX+0xll),B",
+	"BIT 6,(IX+0xll),C",
+	"BIT 6,(IX+0xll),D",
+	"BIT 6,(IX+0xll),E",
+	"BIT 6,(IX+0xll),H",
+	"BIT 6,(IX+0xll),L",
+	"BIT 6,(IX+0xll)",
+	"BIT 6,(IX+0xll),A",
+	"BIT 7,(IX+0xll),B",
+	"BIT 7,(IX+0xll),C",
+	"BIT 7,(IX+0xll),D",
+	"BIT 7,(IX+0xll),E",
+	"BIT 7,(IX+0xll),H",
+	"BIT 7,(IX+0xll),L",
+	"BIT 7,(IX+0xll)",
+	"BIT 7,(IX+0xll),A",
+	"RES 0,(IX+0xll),B",
+	"RES 0,(IX+0xll),C",
+	"RES 0,(IX+0xll),D",
+	"RES 0,(IX+0xll),E",
+	"RES 0,(IX+0xll),H",
+	"RES 0,(IX+0xll),L",
+	"RES 0,(IX+0xll)",
+	"RES 0,(IX+0xll),A",
+	"RES 1,(IX+0xll),B",
+	"RES 1,(IX+0xll),C",
+	"RES 1,(IX+0xll),D",
+	"RES 1,(IX+0xll),E",
+	"RES 1,(IX+0xll),H",
+	"RES 1,(IX+0xll),L",
+	"RES 1,(IX+0xll)",
+	"RES 1,(IX+0xll),A",
+	"RES 2,(IX+0xll),B",
+	"RES 2,(IX+0xll),C",
+	"RES 2,(IX+0xll),D",
+	"RES 2,(IX+0xll),E",
+	"RES 2,(IX+0xll),H",
+	"RES 2,(IX+0xll),L",
+	"RES 2,(IX+0xll)",
+	"RES 2,(IX+0xll),A",
+	"RES 3,(IX+0xll),B",
+	"RES 3,(IX+0xll),C",
+	"RES 3,(IX+0xll),D",
+	"RES 3,(IX+0xll),E",
+	"RES 3,(IX+0xll),H",
+	"RES 3,(IX+0xll),L",
+	"RES 3,(IX+0xll)",
+	"RES 3,(IX+0xll),A",
+	"RES 4,(IX+0xll),B",
+	"RES 4,(IX+0xll),C",
+	"RES 4,(IX+0xll),D",
+	"RES 4,(IX+0xll),E",
+	"RES 4,(IX+0xll),H",
+	"RES 4,(IX+0xll),L",
+	"RES 4,(IX+0xll)",
+	"RES 4,(IX+0xll),A",
+	"RES 5,(IX+0xll),B",
+	"RES 5,(IX+0xll),C",
+	"RES 5,(IX+0xll),D",
+	"RES 5,(IX+0xll),E",
+	"RES 5,(IX+0xll),H",
+	"RES 5,(IX+0xll),L",
+	"RES 5,(IX+0xll)",
+	"RES 5,(IX+0xll),A",
+	"RES 6,(IX+0xll),B",
+	"RES 6,(IX+0xll),C",
+	"RES 6,(IX+0xll),D",
+	"RES 6,(IX+0xll),E",
+	"RES 6,(IX+0xll),H",
+	"RES 6,(IX+0xll),L",
+	"RES 6,(IX+0xll)",
+	"RES 6,(IX+0xll),A",
+	"RES 7,(IX+0xll),B",
+	"RES 7,(IX+0xll),C",
+	"RES 7,(IX+0xll),D",
+	"RES 7,(IX+0xll),E",
+	"RES 7,(IX+0xll),H",
+	"RES 7,(IX+0xll),L",
+	"RES 7,(IX+0xll)",
+	"RES 7,(IX+0xll),A",
+	"SET 0,(IX+0xll),B",
+	"SET 0,(IX+0xll),C",
+	"SET 0,(IX+0xll),D",
+	"SET 0,(IX+0xll),E",
+	"SET 0,(IX+0xll),H",
+	"SET 0,(IX+0xll),L",
+	"SET 0,(IX+0xll)",
+	"SET 0,(IX+0xll),A",
+	"SET 1,(IX+0xll),B",
+	"SET 1,(IX+0xll),C",
+	"SET 1,(IX+0xll),D",
+	"SET 1,(IX+0xll),E",
+	"SET 1,(IX+0xll),H",
+	"SET 1,(IX+0xll),L",
+	"SET 1,(IX+0xll)",
+	"SET 1,(IX+0xll),A",
+	"SET 2,(IX+0xll),B",
+	"SET 2,(IX+0xll),C",
+	"SET 2,(IX+0xll),D",
+	"SET 2,(IX+0xll),E",
+	"SET 2,(IX+0xll),H",
+	"SET 2,(IX+0xll),L",
+	"SET 2,(IX+0xll)",
+	"SET 2,(IX+0xll),A",
+	"SET 3,(IX+0xll),B",
+	"SET 3,(IX+0xll),C",
+	"SET 3,(IX+0xll),D",
+	"SET 3,(IX+0xll),E",
+	"SET 3,(IX+0xll),H",
+	"SET 3,(IX+0xll),L",
+	"SET 3,(IX+0xll)",
+	"SET 3,(IX+0xll),A",
+	"SET 4,(IX+0xll),B",
+	"SET 4,(IX+0xll),C",
+	"SET 4,(IX+0xll),D",
+	"SET 4,(IX+0xll),E",
+	"SET 4,(IX+0xll),H",
+	"SET 4,(IX+0xll),L",
+	"SET 4,(IX+0xll)",
+	"SET 4,(IX+0xll),A",
+	"SET 5,(IX+0xll),B",
+	"SET 5,(IX+0xll),C",
+	"SET 5,(IX+0xll),D",
+	"SET 5,(IX+0xll),E",
+	"SET 5,(IX+0xll),H",
+	"SET 5,(IX+0xll),L",
+	"SET 5,(IX+0xll)",
+	"SET 5,(IX+0xll),A",
+	"SET 6,(IX+0xll),B",
+	"SET 6,(IX+0xll),C",
+	"SET 6,(IX+0xll),D",
+	"SET 6,(IX+0xll),E",
+	"SET 6,(IX+0xll),H",
+	"SET 6,(IX+0xll),L",
+	"SET 6,(IX+0xll)",
+	"SET 6,(IX+0xll),A",
+	"SET 7,(IX+0xll),B",
+	"SET 7,(IX+0xll),C",
+	"SET 7,(IX+0xll),D",
+	"SET 7,(IX+0xll),E",
+	"SET 7,(IX+0xll),H",
+	"SET 7,(IX+0xll),L",
+	"SET 7,(IX+0xll)",
+	"SET 7,(IX+0xll),A",
+
+	//IY BIT Instruction Set
+	"RLC (IY+0xll),B",
+	"RLC (IY+0xll),C",
+	"RLC (IY+0xll),D",
+	"RLC (IY+0xll),E",
+	"RLC (IY+0xll),H",
+	"RLC (IY+0xll),L",
+	"RLC (IY+0xll)",
+	"RLC (IY+0xll),A",
+	"RRC (IY+0xll),B",
+	"RRC (IY+0xll),C",
+	"RRC (IY+0xll),D",
+	"RRC (IY+0xll),E",
+	"RRC (IY+0xll),H",
+	"RRC (IY+0xll),L",
+	"RRC (IY+0xll)",
+	"RRC (IY+0xll),A",
+	"RL (IY+0xll),B",
+	"RL (IY+0xll),C",
+	"RL (IY+0xll),D",
+	"RL (IY+0xll),E",
+	"RL (IY+0xll),H",
+	"RL (IY+0xll),L",
+	"RL (IY+0xll)",
+	"RL (IY+0xll),A",
+	"RR (IY+0xll),B",
+	"RR (IY+0xll),C",
+	"RR (IY+0xll),D",
+	"RR (IY+0xll),E",
+	"RR (IY+0xll),H",
+	"RR (IY+0xll),L",
+	"RR (IY+0xll)",
+	"RR (IY+0xll),A",
+	"SLA (IY+0xll),B",
+	"SLA (IY+0xll),C",
+	"SLA (IY+0xll),D",
+	"SLA (IY+0xll),E",
+	"SLA (IY+0xll),H",
+	"SLA (IY+0xll),L",
+	"SLA (IY+0xll)",
+	"SLA (IY+0xll),A",
+	"SRA (IY+0xll),B",
+	"SRA (IY+0xll),C",
+	"SRA (IY+0xll),D",
+	"SRA (IY+0xll),E",
+	"SRA (IY+0xll),H",
+	"SRA (IY+0xll),L",
+	"SRA (IY+0xll)",
+	"SRA (IY+0xll),A",
+	"SLL (IY+0xll),B",
+	"SLL (IY+0xll),C",
+	"SLL (IY+0xll),D",
+	"SLL (IY+0xll),E",
+	"SLL (IY+0xll),H",
+	"SLL (IY+0xll),L",
+	"SLL (IY+0xll)",
+	"SLL (IY+0xll),A",
+	"SRL (IY+0xll),B",
+	"SRL (IY+0xll),C",
+	"SRL (IY+0xll),D",
+	"SRL (IY+0xll),E",
+	"SRL (IY+0xll),H",
+	"SRL (IY+0xll),L",
+	"SRL (IY+0xll)",
+	"SRL (IY+0xll),A",
+	"BIT 0,(IY+0xll),B",
+	"BIT 0,(IY+0xll),C",
+	"BIT 0,(IY+0xll),D",
+	"BIT 0,(IY+0xll),E",
+	"BIT 0,(IY+0xll),H",
+	"BIT 0,(IY+0xll),L",
+	"BIT 0,(IY+0xll)",
+	"BIT 0,(IY+0xll),A",
+	"BIT 1,(IY+0xll),B",
+	"BIT 1,(IY+0xll),C",
+	"BIT 1,(IY+0xll),D",
+	"BIT 1,(IY+0xll),E",
+	"BIT 1,(IY+0xll),H",
+	"BIT 1,(IY+0xll),L",
+	"BIT 1,(IY+0xll)",
+	"BIT 1,(IY+0xll),A",
+	"BIT 2,(IY+0xll),B",
+	"BIT 2,(IY+0xll),C",
+	"BIT 2,(IY+0xll),D",
+	"BIT 2,(IY+0xll),E",
+	"BIT 2,(IY+0xll),H",
+	"BIT 2,(IY+0xll),L",
+	"BIT 2,(IY+0xll)",
+	"BIT 2,(IY+0xll),A",
+	"BIT 3,(IY+0xll),B",
+	"BIT 3,(IY+0xll),C",
+	"BIT 3,(IY+0xll),D",
+	"BIT 3,(IY+0xll),E",
+	"BIT 3,(IY+0xll),H",
+	"BIT 3,(IY+0xll),L",
+	"BIT 3,(IY+0xll)",
+	"BIT 3,(IY+0xll),A",
+	"BIT 4,(IY+0xll),B",
+	"BIT 4,(IY+0xll),C",
+	"BIT 4,(IY+0xll),D",
+	"BIT 4,(IY+0xll),E",
+	"BIT 4,(IY+0xll),H",
+	"BIT 4,(IY+0xll),L",
+	"BIT 4,(IY+0xll)",
+	"BIT 4,(IY+0xll),A",
+	"BIT 5,(IY+0xll),B",
+	"BIT 5,(IY+0xll),C",
+	"BIT 5,(IY+0xll),D",
+	"BIT 5,(IY+0xll),E",
+	"BIT 5,(IY+0xll),H",
+	"BIT 5,(IY+0xll),L",
+	"BIT 5,(IY+0xll)",
+	"BIT 5,(IY+0xll),A",
+	"BIT 6,(IY+0xll),B",
+	"BIT 6,(IY+0xll),C",
+	"BIT 6,(IY+0xll),D",
+	"BIT 6,(IY+0xll),E",
+	"BIT 6,(IY+0xll),H",
+	"BIT 6,(IY+0xll),L",
+	"BIT 6,(IY+0xll)",
+	"BIT 6,(IY+0xll),A",
+	"BIT 7,(IY+0xll),B",
+	"BIT 7,(IY+0xll),C",
+	"BIT 7,(IY+0xll),D",
+	"BIT 7,(IY+0xll),E",
+	"BIT 7,(IY+0xll),H",
+	"BIT 7,(IY+0xll),L",
+	"BIT 7,(IY+0xll)",
+	"BIT 7,(IY+0xll),A",
+	"RES 0,(IY+0xll),B",
+	"RES 0,(IY+0xll),C",
+	"RES 0,(IY+0xll),D",
+	"RES 0,(IY+0xll),E",
+	"RES 0,(IY+0xll),H",
+	"RES 0,(IY+0xll),L",
+	"RES 0,(IY+0xll)",
+	"RES 0,(IY+0xll),A",
+	"RES 1,(IY+0xll),B",
+	"RES 1,(IY+0xll),C",
+	"RES 1,(IY+0xll),D",
+	"RES 1,(IY+0xll),E",
+	"RES 1,(IY+0xll),H",
+	"RES 1,(IY+0xll),L",
+	"RES 1,(IY+0xll)",
+	"RES 1,(IY+0xll),A",
+	"RES 2,(IY+0xll),B",
+	"RES 2,(IY+0xll),C",
+	"RES 2,(IY+0xll),D",
+	"RES 2,(IY+0xll),E",
+	"RES 2,(IY+0xll),H",
+	"RES 2,(IY+0xll),L",
+	"RES 2,(IY+0xll)",
+	"RES 2,(IY+0xll),A",
+	"RES 3,(IY+0xll),B",
+	"RES 3,(IY+0xll),C",
+	"RES 3,(IY+0xll),D",
+	"RES 3,(IY+0xll),E",
+	"RES 3,(IY+0xll),H",
+	"RES 3,(IY+0xll),L",
+	"RES 3,(IY+0xll)",
+	"RES 3,(IY+0xll),A",
+	"RES 4,(IY+0xll),B",
+	"RES 4,(IY+0xll),C",
+	"RES 4,(IY+0xll),D",
+	"RES 4,(IY+0xll),E",
+	"RES 4,(IY+0xll),H",
+	"RES 4,(IY+0xll),L",
+	"RES 4,(IY+0xll)",
+	"RES 4,(IY+0xll),A",
+	"RES 5,(IY+0xll),B",
+	"RES 5,(IY+0xll),C",
+	"RES 5,(IY+0xll),D",
+	"RES 5,(IY+0xll),E",
+	"RES 5,(IY+0xll),H",
+	"RES 5,(IY+0xll),L",
+	"RES 5,(IY+0xll)",
+	"RES 5,(IY+0xll),A",
+	"RES 6,(IY+0xll),B",
+	"RES 6,(IY+0xll),C",
+	"RES 6,(IY+0xll),D",
+	"RES 6,(IY+0xll),E",
+	"RES 6,(IY+0xll),H",
+	"RES 6,(IY+0xll),L",
+	"RES 6,(IY+0xll)",
+	"RES 6,(IY+0xll),A",
+	"RES 7,(IY+0xll),B",
+	"RES 7,(IY+0xll),C",
+	"RES 7,(IY+0xll),D",
+	"RES 7,(IY+0xll),E",
+	"RES 7,(IY+0xll),H",
+	"RES 7,(IY+0xll),L",
+	"RES 7,(IY+0xll)",
+	"RES 7,(IY+0xll),A",
+	"SET 0,(IY+0xll),B",
+	"SET 0,(IY+0xll),C",
+	"SET 0,(IY+0xll),D",
+	"SET 0,(IY+0xll),E",
+	"SET 0,(IY+0xll),H",
+	"SET 0,(IY+0xll),L",
+	"SET 0,(IY+0xll)",
+	"SET 0,(IY+0xll),A",
+	"SET 1,(IY+0xll),B",
+	"SET 1,(IY+0xll),C",
+	"SET 1,(IY+0xll),D",
+	"SET 1,(IY+0xll),E",
+	"SET 1,(IY+0xll),H",
+	"SET 1,(IY+0xll),L",
+	"SET 1,(IY+0xll)",
+	"SET 1,(IY+0xll),A",
+	"SET 2,(IY+0xll),B",
+	"SET 2,(IY+0xll),C",
+	"SET 2,(IY+0xll),D",
+	"SET 2,(IY+0xll),E",
+	"SET 2,(IY+0xll),H",
+	"SET 2,(IY+0xll),L",
+	"SET 2,(IY+0xll)",
+	"SET 2,(IY+0xll),A",
+	"SET 3,(IY+0xll),B",
+	"SET 3,(IY+0xll),C",
+	"SET 3,(IY+0xll),D",
+	"SET 3,(IY+0xll),E",
+	"SET 3,(IY+0xll),H",
+	"SET 3,(IY+0xll),L",
+	"SET 3,(IY+0xll)",
+	"SET 3,(IY+0xll),A",
+	"SET 4,(IY+0xll),B",
+	"SET 4,(IY+0xll),C",
+	"SET 4,(IY+0xll),D",
+	"SET 4,(IY+0xll),E",
+	"SET 4,(IY+0xll),H",
+	"SET 4,(IY+0xll),L",
+	"SET 4,(IY+0xll)",
+	"SET 4,(IY+0xll),A",
+	"SET 5,(IY+0xll),B",
+	"SET 5,(IY+0xll),C",
+	"SET 5,(IY+0xll),D",
+	"SET 5,(IY+0xll),E",
+	"SET 5,(IY+0xll),H",
+	"SET 5,(IY+0xll),L",
+	"SET 5,(IY+0xll)",
+	"SET 5,(IY+0xll),A",
+	"SET 6,(IY+0xll),B",
+	"SET 6,(IY+0xll),C",
+	"SET 6,(IY+0xll),D",
+	"SET 6,(IY+0xll),E",
+	"SET 6,(IY+0xll),H",
+	"SET 6,(IY+0xll),L",
+	"SET 6,(IY+0xll)",
+	"SET 6,(IY+0xll),A",
+	"SET 7,(IY+0xll),B",
+	"SET 7,(IY+0xll),C",
+	"SET 7,(IY+0xll),D",
+	"SET 7,(IY+0xll),E",
+	"SET 7,(IY+0xll),H",
+	"SET 7,(IY+0xll),L",
+	"SET 7,(IY+0xll)",
+	"SET 7,(IY+0xll),A"
+};
+
+//Precomputed Flags for 8-bit results, built at compile time. XF and YF are never
+//part of a table entry, they are preserved by every Instruction using these tables
+// SZ       - Sign and Zero
+// SZP      - Sign, Zero and Parity
+// SZHV_inc - Sign, Zero, Half Carry and Overflow of the result of an Increment
+// SZHV_dec - Sign, Zero, Half Carry and Overflow of the result of a Decrement, N set
+struct FLAGTABLES
+{
+	uint8_t SZ[256], SZP[256], SZHV_inc[256], SZHV_dec[256];
+
+	constexpr FLAGTABLES() : SZ(), SZP(), SZHV_inc(), SZHV_dec()
+	{
+		for (int i = 0; i < 256; i++)
+		{
+			int bits = 0;
+			for (int b = 0; b < 8; b++)
+				bits += (i >> b) & 1;
+
+			SZ[i] = (i & SM) | ((i == 0) ? ZM : 0);
+			SZP[i] = SZ[i] | (((bits & 1) == 0) ? PM : 0);
+			SZHV_inc[i] = SZ[i] | (((i & 0x0f) == 0x00) ? HM : 0) | ((i == 0x80) ? PM : 0);
+			SZHV_dec[i] = SZ[i] | (((i & 0x0f) == 0x0f) ? HM : 0) | ((i == 0x7f) ? PM : 0) | NM;
+		}
+	}
+};
+
+static constexpr FLAGTABLES flagTable;
+
 Z80A::Z80A()
 {
 	//Init Registers
@@ -26,1821 +3679,10 @@ Z80A::Z80A()
 	irq_latch = false;
 
 	nCycleCounter = 0;
+	nInstrCounter = 0;
 	
 	//Debug Only
 	bOpcodeComplete = false;
-
-	//Init Main Dictionary
-	using z = Z80A;
-		
-	instSet =
-	{
-		//MAIN Instruction Set
-		{"NOP ", &z::NOP, 4, 0, 1},
-		{"LD BC,0xhhll", &z::LDDDNN, 10, 0, 3},
-		{"LD (BC),A", &z::LDiBCA, 7, 0, 1},
-		{"INC BC", &z::INCSS, 6, 0, 1},
-		{"INC B", &z::INCR, 4, 0, 1},
-		{"DEC B", &z::DECR, 4, 0, 1},
-		{"LD B,0xll", &z::LDRN, 7, 0, 2},
-		{"RLCA ", &z::RLCA, 4, 0, 1},
-		{"EX AF,AF'", &z::EXAF, 4, 0, 1},
-		{"ADD HL,BC", &z::ADDHLSS, 11, 0, 1},
-		{"LD A,(BC)", &z::LDAiBC, 7, 0, 1},
-		{"DEC BC", &z::DECSS, 6, 0, 1},
-		{"INC C", &z::INCR, 4, 0, 1},
-		{"DEC C", &z::DECR, 4, 0, 1},
-		{"LD C,0xll", &z::LDRN, 7, 0, 2},
-		{"RRCA ", &z::RRCA, 4, 0, 1},
-		{"DJNZ 0xll", &z::DJNZE, 13, 8, 2},
-		{"LD DE,0xhhll", &z::LDDDNN, 10, 0, 3},
-		{"LD (DE),A", &z::LDiDEA, 7, 0, 1},
-		{"INC DE", &z::INCSS, 6, 0, 1},
-		{"INC D", &z::INCR, 4, 0, 1},
-		{"DEC D", &z::DECR, 4, 0, 1},
-		{"LD D,0xll", &z::LDRN, 7, 0, 2},
-		{"RLA ", &z::RLA, 4, 0, 1},
-		{"JR 0xll", &z::JRE, 12, 0, 2},
-		{"ADD HL,DE", &z::ADDHLSS, 11, 0, 1},
-		{"LD A,(DE)", &z::LDAiDE, 7, 0, 1},
-		{"DEC DE", &z::DECSS, 6, 0, 1},
-		{"INC E", &z::INCR, 4, 0, 1},
-		{"DEC E", &z::DECR, 4, 0, 1},
-		{"LD E,0xll", &z::LDRN, 7, 0, 2},
-		{"RRA ", &z::RRA, 4, 0, 1},
-		{"JR NZ 0xll", &z::JRNZE, 12, 7, 2},
-		{"LD HL,0xhhll", &z::LDDDNN, 10, 0, 3},
-		{"LD (0xhhll),HL", &z::LDiNNHL, 16, 0, 3},
-		{"INC HL", &z::INCSS, 6, 0, 1},
-		{"INC H", &z::INCR, 4, 0, 1},
-		{"DEC H", &z::DECR, 4, 0, 1},
-		{"LD H,0xll", &z::LDRN, 7, 0, 2},
-		{"DAA ", &z::DAA, 4, 0, 1},
-		{"JR Z 0xll", &z::JRZE, 12, 7, 2},
-		{"ADD HL,HL", &z::ADDHLSS, 11, 0, 1},
-		{"LD HL,(0xhhll)", &z::LDHLiNN, 16, 0, 3},
-		{"DEC HL", &z::DECSS, 6, 0, 1},
-		{"INC L", &z::INCR, 4, 0, 1},
-		{"DEC L", &z::DECR, 4, 0, 1},
-		{"LD L,0xll", &z::LDRN, 7, 0, 2},
-		{"CPL ", &z::CPL, 4, 0, 1},
-		{"JR NC 0xll", &z::JRNCE, 12, 7, 2},
-		{"LD SP,0xhhll", &z::LDDDNN, 10, 0, 3},
-		{"LD (0xhhll),A", &z::LDiNNA, 13, 0, 3},
-		{"INC SP", &z::INCSS, 6, 0, 1},
-		{"INC (HL)", &z::INCR, 11, 0, 1},
-		{"DEC (HL)", &z::DECR, 11, 0, 1},
-		{"LD (HL),0xll", &z::LDRN, 10, 0, 2},
-		{"SCF ", &z::SCF, 4, 0, 1},
-		{"JR C 0xll", &z::JRCE, 12, 7, 2},
-		{"ADD HL,SP", &z::ADDHLSS, 11, 0, 1},
-		{"LD A,(0xhhll)", &z::LDAiNN, 13, 0, 3},
-		{"DEC SP", &z::DECSS, 6, 0, 1},
-		{"INC A", &z::INCR, 4, 0, 1},
-		{"DEC A", &z::DECR, 4, 0, 1},
-		{"LD A,0xll", &z::LDRN, 7, 0, 2},
-		{"CCF ", &z::CCF, 4, 0, 1},
-		{"LD B,B", &z::LDRR, 4, 0, 1},
-		{"LD B,C", &z::LDRR, 4, 0, 1},
-		{"LD B,D", &z::LDRR, 4, 0, 1},
-		{"LD B,E", &z::LDRR, 4, 0, 1},
-		{"LD B,H", &z::LDRR, 4, 0, 1},
-		{"LD B,L", &z::LDRR, 4, 0, 1},
-		{"LD B,(HL)", &z::LDRRi, 7, 0, 1},
-		{"LD B,A", &z::LDRR, 4, 0, 1},
-		{"LD C,B", &z::LDRR, 4, 0, 1},
-		{"LD C,C", &z::LDRR, 4, 0, 1},
-		{"LD C,D", &z::LDRR, 4, 0, 1},
-		{"LD C,E", &z::LDRR, 4, 0, 1},
-		{"LD C,H", &z::LDRR, 4, 0, 1},
-		{"LD C,L", &z::LDRR, 4, 0, 1},
-		{"LD C,(HL)", &z::LDRRi, 7, 0, 1},
-		{"LD C,A", &z::LDRR, 4, 0, 1},
-		{"LD D,B", &z::LDRR, 4, 0, 1},
-		{"LD D,C", &z::LDRR, 4, 0, 1},
-		{"LD D,D", &z::LDRR, 4, 0, 1},
-		{"LD D,E", &z::LDRR, 4, 0, 1},
-		{"LD D,H", &z::LDRR, 4, 0, 1},
-		{"LD D,L", &z::LDRR, 4, 0, 1},
-		{"LD D,(HL)", &z::LDRRi, 7, 0, 1},
-		{"LD D,A", &z::LDRR, 4, 0, 1},
-		{"LD E,B", &z::LDRR, 4, 0, 1},
-		{"LD E,C", &z::LDRR, 4, 0, 1},
-		{"LD E,D", &z::LDRR, 4, 0, 1},
-		{"LD E,E", &z::LDRR, 4, 0, 1},
-		{"LD E,H", &z::LDRR, 4, 0, 1},
-		{"LD E,L", &z::LDRR, 4, 0, 1},
-		{"LD E,(HL)", &z::LDRRi, 7, 0, 1},
-		{"LD E,A", &z::LDRR, 4, 0, 1},
-		{"LD H,B", &z::LDRR, 4, 0, 1},
-		{"LD H,C", &z::LDRR, 4, 0, 1},
-		{"LD H,D", &z::LDRR, 4, 0, 1},
-		{"LD H,E", &z::LDRR, 4, 0, 1},
-		{"LD H,H", &z::LDRR, 4, 0, 1},
-		{"LD H,L", &z::LDRR, 4, 0, 1},
-		{"LD H,(HL)", &z::LDRRi, 7, 0, 1},
-		{"LD H,A", &z::LDRR, 4, 0, 1},
-		{"LD L,B", &z::LDRR, 4, 0, 1},
-		{"LD L,C", &z::LDRR, 4, 0, 1},
-		{"LD L,D", &z::LDRR, 4, 0, 1},
-		{"LD L,E", &z::LDRR, 4, 0, 1},
-		{"LD L,H", &z::LDRR, 4, 0, 1},
-		{"LD L,L", &z::LDRR, 4, 0, 1},
-		{"LD L,(HL)", &z::LDRRi, 7, 0, 1},
-		{"LD L,A", &z::LDRR, 4, 0, 1},
-		{"LD (HL),B", &z::LDiRR, 7, 0, 1},
-		{"LD (HL),C", &z::LDiRR, 7, 0, 1},
-		{"LD (HL),D", &z::LDiRR, 7, 0, 1},
-		{"LD (HL),E", &z::LDiRR, 7, 0, 1},
-		{"LD (HL),H", &z::LDiRR, 7, 0, 1},
-		{"LD (HL),L", &z::LDiRR, 7, 0, 1},
-		{"HALT ", &z::HALT, 4, 0, 1},
-		{"LD (HL),A", &z::LDiRR, 7, 0, 1},
-		{"LD A,B", &z::LDRR, 4, 0, 1},
-		{"LD A,C", &z::LDRR, 4, 0, 1},
-		{"LD A,D", &z::LDRR, 4, 0, 1},
-		{"LD A,E", &z::LDRR, 4, 0, 1},
-		{"LD A,H", &z::LDRR, 4, 0, 1},
-		{"LD A,L", &z::LDRR, 4, 0, 1},
-		{"LD A,(HL)", &z::LDRRi, 7, 0, 1},
-		{"LD A,A", &z::LDRR, 4, 0, 1},
-		{"ADD A,B", &z::ADDR, 4, 0, 1},
-		{"ADD A,C", &z::ADDR, 4, 0, 1},
-		{"ADD A,D", &z::ADDR, 4, 0, 1},
-		{"ADD A,E", &z::ADDR, 4, 0, 1},
-		{"ADD A,H", &z::ADDR, 4, 0, 1},
-		{"ADD A,L", &z::ADDR, 4, 0, 1},
-		{"ADD A,(HL)", &z::ADDR, 7, 0, 1},
-		{"ADD A,A", &z::ADDR, 4, 0, 1},
-		{"ADC A,B", &z::ADCR, 4, 0, 1},
-		{"ADC A,C", &z::ADCR, 4, 0, 1},
-		{"ADC A,D", &z::ADCR, 4, 0, 1},
-		{"ADC A,E", &z::ADCR, 4, 0, 1},
-		{"ADC A,H", &z::ADCR, 4, 0, 1},
-		{"ADC A,L", &z::ADCR, 4, 0, 1},
-		{"ADC A,(HL)", &z::ADCR, 7, 0, 1},
-		{"ADC A,A", &z::ADCR, 4, 0, 1},
-		{"SUB A,B", &z::SUBR, 4, 0, 1},
-		{"SUB A,C", &z::SUBR, 4, 0, 1},
-		{"SUB A,D", &z::SUBR, 4, 0, 1},
-		{"SUB A,E", &z::SUBR, 4, 0, 1},
-		{"SUB A,H", &z::SUBR, 4, 0, 1},
-		{"SUB A,L", &z::SUBR, 4, 0, 1},
-		{"SUB A,(HL)", &z::SUBR, 7, 0, 1},
-		{"SUB A,A", &z::SUBR, 4, 0, 1},
-		{"SBC A,B", &z::SBCR, 4, 0, 1},
-		{"SBC A,C", &z::SBCR, 4, 0, 1},
-		{"SBC A,D", &z::SBCR, 4, 0, 1},
-		{"SBC A,E", &z::SBCR, 4, 0, 1},
-		{"SBC A,H", &z::SBCR, 4, 0, 1},
-		{"SBC A,L", &z::SBCR, 4, 0, 1},
-		{"SBC A,(HL)", &z::SBCR, 7, 0, 1},
-		{"SBC A,A", &z::SBCR, 4, 0, 1},
-		{"AND B", &z::ANDR, 4, 0, 1},
-		{"AND C", &z::ANDR, 4, 0, 1},
-		{"AND D", &z::ANDR, 4, 0, 1},
-		{"AND E", &z::ANDR, 4, 0, 1},
-		{"AND H", &z::ANDR, 4, 0, 1},
-		{"AND L", &z::ANDR, 4, 0, 1},
-		{"AND (HL)", &z::ANDR, 7, 0, 1},
-		{"AND A", &z::ANDR, 4, 0, 1},
-		{"XOR B", &z::XORR, 4, 0, 1},
-		{"XOR C", &z::XORR, 4, 0, 1},
-		{"XOR D", &z::XORR, 4, 0, 1},
-		{"XOR E", &z::XORR, 4, 0, 1},
-		{"XOR H", &z::XORR, 4, 0, 1},
-		{"XOR L", &z::XORR, 4, 0, 1},
-		{"XOR (HL)", &z::XORR, 7, 0, 1},
-		{"XOR A", &z::XORR, 4, 0, 1},
-		{"OR B", &z::ORR, 4, 0, 1},
-		{"OR C", &z::ORR, 4, 0, 1},
-		{"OR D", &z::ORR, 4, 0, 1},
-		{"OR E", &z::ORR, 4, 0, 1},
-		{"OR H", &z::ORR, 4, 0, 1},
-		{"OR L", &z::ORR, 4, 0, 1},
-		{"OR (HL)", &z::ORR, 7, 0, 1},
-		{"OR A", &z::ORR, 4, 0, 1},
-		{"CP B", &z::CPR, 4, 0, 1},
-		{"CP C", &z::CPR, 4, 0, 1},
-		{"CP D", &z::CPR, 4, 0, 1},
-		{"CP E", &z::CPR, 4, 0, 1},
-		{"CP H", &z::CPR, 4, 0, 1},
-		{"CP L", &z::CPR, 4, 0, 1},
-		{"CP (HL)", &z::CPR, 7, 0, 1},
-		{"CP A", &z::CPR, 4, 0, 1},
-		{"RET NZ ", &z::RETCC, 11, 5, 1},
-		{"POP BC", &z::POPQQ, 10, 0, 1},
-		{"JP NZ 0xhhll", &z::JPCCNN, 10, 0, 3},
-		{"JP 0xhhll", &z::JPNN, 10, 0, 3},
-		{"CALL NZ 0xhhll", &z::CALLCCNN, 17, 10, 3},
-		{"PUSH BC", &z::PUSHQQ, 11, 0, 1},
-		{"ADD A,0xll", &z::ADDN, 7, 0, 2},
-		{"RST 00h", &z::RSTP, 11, 0, 1},
-		{"RET Z ", &z::RETCC, 11, 5, 1},
-		{"RET ", &z::RET, 10, 0, 1},
-		{"JP Z 0xhhll", &z::JPCCNN, 10, 0, 3},
-		{"XXX", &z::INVAL, 0, 0, 1},
-		{"CALL Z 0xhhll", &z::CALLCCNN, 17, 10, 3},
-		{"CALL 0xhhll", &z::CALLNN, 17, 0, 3},
-		{"ADC A,0xll", &z::ADCN, 7, 0, 2},
-		{"RST 08h", &z::RSTP, 11, 0, 1},
-		{"RET NC ", &z::RETCC, 11, 5, 1},
-		{"POP DE", &z::POPQQ, 10, 0, 1},
-		{"JP NC 0xhhll", &z::JPCCNN, 10, 0, 3},
-		{"OUT (0xll),A", &z::OUTiNA, 11, 0, 2},
-		{"CALL NC 0xhhll", &z::CALLCCNN, 17, 10, 3},
-		{"PUSH DE", &z::PUSHQQ, 11, 0, 1},
-		{"SUB A,0xll", &z::SUBN, 7, 0, 2},
-		{"RST 10h", &z::RSTP, 11, 0, 1},
-		{"RET C ", &z::RETCC, 11, 5, 1},
-		{"EXX ", &z::EXX, 4, 0, 1},
-		{"JP C 0xhhll", &z::JPCCNN, 10, 0, 3},
-		{"IN A,(0xll)", &z::INAiN, 11, 0, 2},
-		{"CALL C 0xhhll", &z::CALLCCNN, 17, 10, 3},
-		{"XXX", &z::INVAL, 0, 0, 1},
-		{"SBC A,0xll", &z::SBCN, 7, 0, 2},
-		{"RST 18h", &z::RSTP, 11, 0, 1},
-		{"RET PO ", &z::RETCC, 11, 5, 1},
-		{"POP HL", &z::POPQQ, 10, 0, 1},
-		{"JP PO 0xhhll", &z::JPCCNN, 10, 0, 3},
-		{"EX (SP),HL", &z::EXiSPHL, 19, 0, 1},
-		{"CALL PO 0xhhll", &z::CALLCCNN, 17, 10, 3},
-		{"PUSH HL", &z::PUSHQQ, 11, 0, 1},
-		{"AND 0xll", &z::ANDN, 7, 0, 2},
-		{"RST 20h", &z::RSTP, 11, 0, 1},
-		{"RET PE ", &z::RETCC, 11, 5, 1},
-		{"JP (HL)", &z::JPiHL, 4, 0, 1},
-		{"JP PE 0xhhll", &z::JPCCNN, 10, 0, 3},
-		{"EX DE,HL", &z::EXDEHL, 4, 0, 1},
-		{"CALL PE 0xhhll", &z::CALLCCNN, 17, 10, 3},
-		{"XXX", &z::INVAL, 0, 0, 1},
-		{"XOR 0xll", &z::XORN, 7, 0, 2},
-		{"RST 28h", &z::RSTP, 11, 0, 1},
-		{"RET P ", &z::RETCC, 11, 5, 1},
-		{"POP AF", &z::POPQQ, 10, 0, 1},
-		{"JP P 0xhhll", &z::JPCCNN, 10, 0, 3},
-		{"DI ", &z::DI, 4, 0, 1},
-		{"CALL P 0xhhll", &z::CALLCCNN, 17, 10, 3},
-		{"PUSH AF", &z::PUSHQQ, 11, 0, 1},
-		{"OR 0xll", &z::ORN, 7, 0, 2},
-		{"RST 30h", &z::RSTP, 11, 0, 1},
-		{"RET M ", &z::RETCC, 11, 5, 1},
-		{"LD SP,HL", &z::LDSPHL, 6, 0, 1},
-		{"JP M 0xhhll", &z::JPCCNN, 10, 0, 3},
-		{"EI ", &z::EI, 4, 0, 1},
-		{"CALL M 0xhhll", &z::CALLCCNN, 17, 10, 3},
-		{"XXX", &z::INVAL, 0, 0, 1},
-		{"CP 0xll", &z::CPN, 7, 0, 2},
-		{"RST 38h", &z::RSTP, 11, 0, 1},
-					
-		//BIT Instruction Set
-		{ "RLC B", &z::RLCR, 8, 0, 2 },
-		{ "RLC C", &z::RLCR, 8, 0, 2 },
-		{ "RLC D", &z::RLCR, 8, 0, 2 },
-		{ "RLC E", &z::RLCR, 8, 0, 2 },
-		{ "RLC H", &z::RLCR, 8, 0, 2 },
-		{ "RLC L", &z::RLCR, 8, 0, 2 },
-		{ "RLC (HL)", &z::RLCR, 15, 0, 2 },
-		{ "RLC A", &z::RLCR, 8, 0, 2 },
-		{ "RRC B", &z::RRCR, 8, 0, 2 },
-		{ "RRC C", &z::RRCR, 8, 0, 2 },
-		{ "RRC D", &z::RRCR, 8, 0, 2 },
-		{ "RRC E", &z::RRCR, 8, 0, 2 },
-		{ "RRC H", &z::RRCR, 8, 0, 2 },
-		{ "RRC L", &z::RRCR, 8, 0, 2 },
-		{ "RRC (HL)", &z::RRCR, 15, 0, 2 },
-		{ "RRC A", &z::RRCR, 8, 0, 2 },
-		{ "RL B", &z::RLR, 8, 0, 2 },
-		{ "RL C", &z::RLR, 8, 0, 2 },
-		{ "RL D", &z::RLR, 8, 0, 2 },
-		{ "RL E", &z::RLR, 8, 0, 2 },
-		{ "RL H", &z::RLR, 8, 0, 2 },
-		{ "RL L", &z::RLR, 8, 0, 2 },
-		{ "RL (HL)", &z::RLR, 15, 0, 2 },
-		{ "RL A", &z::RLR, 8, 0, 2 },
-		{ "RR B", &z::RRR, 8, 0, 2 },
-		{ "RR C", &z::RRR, 8, 0, 2 },
-		{ "RR D", &z::RRR, 8, 0, 2 },
-		{ "RR E", &z::RRR, 8, 0, 2 },
-		{ "RR H", &z::RRR, 8, 0, 2 },
-		{ "RR L", &z::RRR, 8, 0, 2 },
-		{ "RR (HL)", &z::RRR, 15, 0, 2 },
-		{ "RR A", &z::RRR, 8, 0, 2 },
-		{ "SLA B", &z::SLAR, 8, 0, 2 },
-		{ "SLA C", &z::SLAR, 8, 0, 2 },
-		{ "SLA D", &z::SLAR, 8, 0, 2 },
-		{ "SLA E", &z::SLAR, 8, 0, 2 },
-		{ "SLA H", &z::SLAR, 8, 0, 2 },
-		{ "SLA L", &z::SLAR, 8, 0, 2 },
-		{ "SLA (HL)", &z::SLAR, 15, 0, 2 },
-		{ "SLA A", &z::SLAR, 8, 0, 2 },
-		{ "SRA B", &z::SRAR, 8, 0, 2 },
-		{ "SRA C", &z::SRAR, 8, 0, 2 },
-		{ "SRA D", &z::SRAR, 8, 0, 2 },
-		{ "SRA E", &z::SRAR, 8, 0, 2 },
-		{ "SRA H", &z::SRAR, 8, 0, 2 },
-		{ "SRA L", &z::SRAR, 8, 0, 2 },
-		{ "SRA (HL)", &z::SRAR, 15, 0, 2 },
-		{ "SRA A", &z::SRAR, 8, 0, 2 },
-		{ "SLL B", &z::SLLR, 8, 0, 2 },
-		{ "SLL C", &z::SLLR, 8, 0, 2 },
-		{ "SLL D", &z::SLLR, 8, 0, 2 },
-		{ "SLL E", &z::SLLR, 8, 0, 2 },
-		{ "SLL H", &z::SLLR, 8, 0, 2 },
-		{ "SLL L", &z::SLLR, 8, 0, 2 },
-		{ "SLL (HL)", &z::SLLR, 15, 0, 2 },
-		{ "SLL A", &z::SLLR, 8, 0, 2 },
-		{ "SRL B", &z::SRLR, 8, 0, 2 },
-		{ "SRL C", &z::SRLR, 8, 0, 2 },
-		{ "SRL D", &z::SRLR, 8, 0, 2 },
-		{ "SRL E", &z::SRLR, 8, 0, 2 },
-		{ "SRL H", &z::SRLR, 8, 0, 2 },
-		{ "SRL L", &z::SRLR, 8, 0, 2 },
-		{ "SRL (HL)", &z::SRLR, 15, 0, 2 },
-		{ "SRL A", &z::SRLR, 8, 0, 2 },
-		{ "BIT 0,B", &z::BITBR, 8, 0, 2 },
-		{ "BIT 0,C", &z::BITBR, 8, 0, 2 },
-		{ "BIT 0,D", &z::BITBR, 8, 0, 2 },
-		{ "BIT 0,E", &z::BITBR, 8, 0, 2 },
-		{ "BIT 0,H", &z::BITBR, 8, 0, 2 },
-		{ "BIT 0,L", &z::BITBR, 8, 0, 2 },
-		{ "BIT 0,(HL)", &z::BITBR, 12, 0, 2 },
-		{ "BIT 0,A", &z::BITBR, 8, 0, 2 },
-		{ "BIT 1,B", &z::BITBR, 8, 0, 2 },
-		{ "BIT 1,C", &z::BITBR, 8, 0, 2 },
-		{ "BIT 1,D", &z::BITBR, 8, 0, 2 },
-		{ "BIT 1,E", &z::BITBR, 8, 0, 2 },
-		{ "BIT 1,H", &z::BITBR, 8, 0, 2 },
-		{ "BIT 1,L", &z::BITBR, 8, 0, 2 },
-		{ "BIT 1,(HL)", &z::BITBR, 12, 0, 2 },
-		{ "BIT 1,A", &z::BITBR, 8, 0, 2 },
-		{ "BIT 2,B", &z::BITBR, 8, 0, 2 },
-		{ "BIT 2,C", &z::BITBR, 8, 0, 2 },
-		{ "BIT 2,D", &z::BITBR, 8, 0, 2 },
-		{ "BIT 2,E", &z::BITBR, 8, 0, 2 },
-		{ "BIT 2,H", &z::BITBR, 8, 0, 2 },
-		{ "BIT 2,L", &z::BITBR, 8, 0, 2 },
-		{ "BIT 2,(HL)", &z::BITBR, 12, 0, 2 },
-		{ "BIT 2,A", &z::BITBR, 8, 0, 2 },
-		{ "BIT 3,B", &z::BITBR, 8, 0, 2 },
-		{ "BIT 3,C", &z::BITBR, 8, 0, 2 },
-		{ "BIT 3,D", &z::BITBR, 8, 0, 2 },
-		{ "BIT 3,E", &z::BITBR, 8, 0, 2 },
-		{ "BIT 3,H", &z::BITBR, 8, 0, 2 },
-		{ "BIT 3,L", &z::BITBR, 8, 0, 2 },
-		{ "BIT 3,(HL)", &z::BITBR, 12, 0, 2 },
-		{ "BIT 3,A", &z::BITBR, 8, 0, 2 },
-		{ "BIT 4,B", &z::BITBR, 8, 0, 2 },
-		{ "BIT 4,C", &z::BITBR, 8, 0, 2 },
-		{ "BIT 4,D", &z::BITBR, 8, 0, 2 },
-		{ "BIT 4,E", &z::BITBR, 8, 0, 2 },
-		{ "BIT 4,H", &z::BITBR, 8, 0, 2 },
-		{ "BIT 4,L", &z::BITBR, 8, 0, 2 },
-		{ "BIT 4,(HL)", &z::BITBR, 12, 0, 2 },
-		{ "BIT 4,A", &z::BITBR, 8, 0, 2 },
-		{ "BIT 5,B", &z::BITBR, 8, 0, 2 },
-		{ "BIT 5,C", &z::BITBR, 8, 0, 2 },
-		{ "BIT 5,D", &z::BITBR, 8, 0, 2 },
-		{ "BIT 5,E", &z::BITBR, 8, 0, 2 },
-		{ "BIT 5,H", &z::BITBR, 8, 0, 2 },
-		{ "BIT 5,L", &z::BITBR, 8, 0, 2 },
-		{ "BIT 5,(HL)", &z::BITBR, 12, 0, 2 },
-		{ "BIT 5,A", &z::BITBR, 8, 0, 2 },
-		{ "BIT 6,B", &z::BITBR, 8, 0, 2 },
-		{ "BIT 6,C", &z::BITBR, 8, 0, 2 },
-		{ "BIT 6,D", &z::BITBR, 8, 0, 2 },
-		{ "BIT 6,E", &z::BITBR, 8, 0, 2 },
-		{ "BIT 6,H", &z::BITBR, 8, 0, 2 },
-		{ "BIT 6,L", &z::BITBR, 8, 0, 2 },
-		{ "BIT 6,(HL)", &z::BITBR, 12, 0, 2 },
-		{ "BIT 6,A", &z::BITBR, 8, 0, 2 },
-		{ "BIT 7,B", &z::BITBR, 8, 0, 2 },
-		{ "BIT 7,C", &z::BITBR, 8, 0, 2 },
-		{ "BIT 7,D", &z::BITBR, 8, 0, 2 },
-		{ "BIT 7,E", &z::BITBR, 8, 0, 2 },
-		{ "BIT 7,H", &z::BITBR, 8, 0, 2 },
-		{ "BIT 7,L", &z::BITBR, 8, 0, 2 },
-		{ "BIT 7,(HL)", &z::BITBR, 12, 0, 2 },
-		{ "BIT 7,A", &z::BITBR, 8, 0, 2 },
-		{ "RES 0,B", &z::RESBR, 8, 0, 2 },
-		{ "RES 0,C", &z::RESBR, 8, 0, 2 },
-		{ "RES 0,D", &z::RESBR, 8, 0, 2 },
-		{ "RES 0,E", &z::RESBR, 8, 0, 2 },
-		{ "RES 0,H", &z::RESBR, 8, 0, 2 },
-		{ "RES 0,L", &z::RESBR, 8, 0, 2 },
-		{ "RES 0,(HL)", &z::RESBR, 15, 0, 2 },
-		{ "RES 0,A", &z::RESBR, 8, 0, 2 },
-		{ "RES 1,B", &z::RESBR, 8, 0, 2 },
-		{ "RES 1,C", &z::RESBR, 8, 0, 2 },
-		{ "RES 1,D", &z::RESBR, 8, 0, 2 },
-		{ "RES 1,E", &z::RESBR, 8, 0, 2 },
-		{ "RES 1,H", &z::RESBR, 8, 0, 2 },
-		{ "RES 1,L", &z::RESBR, 8, 0, 2 },
-		{ "RES 1,(HL)", &z::RESBR, 15, 0, 2 },
-		{ "RES 1,A", &z::RESBR, 8, 0, 2 },
-		{ "RES 2,B", &z::RESBR, 8, 0, 2 },
-		{ "RES 2,C", &z::RESBR, 8, 0, 2 },
-		{ "RES 2,D", &z::RESBR, 8, 0, 2 },
-		{ "RES 2,E", &z::RESBR, 8, 0, 2 },
-		{ "RES 2,H", &z::RESBR, 8, 0, 2 },
-		{ "RES 2,L", &z::RESBR, 8, 0, 2 },
-		{ "RES 2,(HL)", &z::RESBR, 15, 0, 2 },
-		{ "RES 2,A", &z::RESBR, 8, 0, 2 },
-		{ "RES 3,B", &z::RESBR, 8, 0, 2 },
-		{ "RES 3,C", &z::RESBR, 8, 0, 2 },
-		{ "RES 3,D", &z::RESBR, 8, 0, 2 },
-		{ "RES 3,E", &z::RESBR, 8, 0, 2 },
-		{ "RES 3,H", &z::RESBR, 8, 0, 2 },
-		{ "RES 3,L", &z::RESBR, 8, 0, 2 },
-		{ "RES 3,(HL)", &z::RESBR, 15, 0, 2 },
-		{ "RES 3,A", &z::RESBR, 8, 0, 2 },
-		{ "RES 4,B", &z::RESBR, 8, 0, 2 },
-		{ "RES 4,C", &z::RESBR, 8, 0, 2 },
-		{ "RES 4,D", &z::RESBR, 8, 0, 2 },
-		{ "RES 4,E", &z::RESBR, 8, 0, 2 },
-		{ "RES 4,H", &z::RESBR, 8, 0, 2 },
-		{ "RES 4,L", &z::RESBR, 8, 0, 2 },
-		{ "RES 4,(HL)", &z::RESBR, 15, 0, 2 },
-		{ "RES 4,A", &z::RESBR, 8, 0, 2 },
-		{ "RES 5,B", &z::RESBR, 8, 0, 2 },
-		{ "RES 5,C", &z::RESBR, 8, 0, 2 },
-		{ "RES 5,D", &z::RESBR, 8, 0, 2 },
-		{ "RES 5,E", &z::RESBR, 8, 0, 2 },
-		{ "RES 5,H", &z::RESBR, 8, 0, 2 },
-		{ "RES 5,L", &z::RESBR, 8, 0, 2 },
-		{ "RES 5,(HL)", &z::RESBR, 15, 0, 2 },
-		{ "RES 5,A", &z::RESBR, 8, 0, 2 },
-		{ "RES 6,B", &z::RESBR, 8, 0, 2 },
-		{ "RES 6,C", &z::RESBR, 8, 0, 2 },
-		{ "RES 6,D", &z::RESBR, 8, 0, 2 },
-		{ "RES 6,E", &z::RESBR, 8, 0, 2 },
-		{ "RES 6,H", &z::RESBR, 8, 0, 2 },
-		{ "RES 6,L", &z::RESBR, 8, 0, 2 },
-		{ "RES 6,(HL)", &z::RESBR, 15, 0, 2 },
-		{ "RES 6,A", &z::RESBR, 8, 0, 2 },
-		{ "RES 7,B", &z::RESBR, 8, 0, 2 },
-		{ "RES 7,C", &z::RESBR, 8, 0, 2 },
-		{ "RES 7,D", &z::RESBR, 8, 0, 2 },
-		{ "RES 7,E", &z::RESBR, 8, 0, 2 },
-		{ "RES 7,H", &z::RESBR, 8, 0, 2 },
-		{ "RES 7,L", &z::RESBR, 8, 0, 2 },
-		{ "RES 7,(HL)", &z::RESBR, 15, 0, 2 },
-		{ "RES 7,A", &z::RESBR, 8, 0, 2 },
-		{ "SET 0,B", &z::SETBR, 8, 0, 2 },
-		{ "SET 0,C", &z::SETBR, 8, 0, 2 },
-		{ "SET 0,D", &z::SETBR, 8, 0, 2 },
-		{ "SET 0,E", &z::SETBR, 8, 0, 2 },
-		{ "SET 0,H", &z::SETBR, 8, 0, 2 },
-		{ "SET 0,L", &z::SETBR, 8, 0, 2 },
-		{ "SET 0,(HL)", &z::SETBR, 15, 0, 2 },
-		{ "SET 0,A", &z::SETBR, 8, 0, 2 },
-		{ "SET 1,B", &z::SETBR, 8, 0, 2 },
-		{ "SET 1,C", &z::SETBR, 8, 0, 2 },
-		{ "SET 1,D", &z::SETBR, 8, 0, 2 },
-		{ "SET 1,E", &z::SETBR, 8, 0, 2 },
-		{ "SET 1,H", &z::SETBR, 8, 0, 2 },
-		{ "SET 1,L", &z::SETBR, 8, 0, 2 },
-		{ "SET 1,(HL)", &z::SETBR, 15, 0, 2 },
-		{ "SET 1,A", &z::SETBR, 8, 0, 2 },
-		{ "SET 2,B", &z::SETBR, 8, 0, 2 },
-		{ "SET 2,C", &z::SETBR, 8, 0, 2 },
-		{ "SET 2,D", &z::SETBR, 8, 0, 2 },
-		{ "SET 2,E", &z::SETBR, 8, 0, 2 },
-		{ "SET 2,H", &z::SETBR, 8, 0, 2 },
-		{ "SET 2,L", &z::SETBR, 8, 0, 2 },
-		{ "SET 2,(HL)", &z::SETBR, 15, 0, 2 },
-		{ "SET 2,A", &z::SETBR, 8, 0, 2 },
-		{ "SET 3,B", &z::SETBR, 8, 0, 2 },
-		{ "SET 3,C", &z::SETBR, 8, 0, 2 },
-		{ "SET 3,D", &z::SETBR, 8, 0, 2 },
-		{ "SET 3,E", &z::SETBR, 8, 0, 2 },
-		{ "SET 3,H", &z::SETBR, 8, 0, 2 },
-		{ "SET 3,L", &z::SETBR, 8, 0, 2 },
-		{ "SET 3,(HL)", &z::SETBR, 15, 0, 2 },
-		{ "SET 3,A", &z::SETBR, 8, 0, 2 },
-		{ "SET 4,B", &z::SETBR, 8, 0, 2 },
-		{ "SET 4,C", &z::SETBR, 8, 0, 2 },
-		{ "SET 4,D", &z::SETBR, 8, 0, 2 },
-		{ "SET 4,E", &z::SETBR, 8, 0, 2 },
-		{ "SET 4,H", &z::SETBR, 8, 0, 2 },
-		{ "SET 4,L", &z::SETBR, 8, 0, 2 },
-		{ "SET 4,(HL)", &z::SETBR, 15, 0, 2 },
-		{ "SET 4,A", &z::SETBR, 8, 0, 2 },
-		{ "SET 5,B", &z::SETBR, 8, 0, 2 },
-		{ "SET 5,C", &z::SETBR, 8, 0, 2 },
-		{ "SET 5,D", &z::SETBR, 8, 0, 2 },
-		{ "SET 5,E", &z::SETBR, 8, 0, 2 },
-		{ "SET 5,H", &z::SETBR, 8, 0, 2 },
-		{ "SET 5,L", &z::SETBR, 8, 0, 2 },
-		{ "SET 5,(HL)", &z::SETBR, 15, 0, 2 },
-		{ "SET 5,A", &z::SETBR, 8, 0, 2 },
-		{ "SET 6,B", &z::SETBR, 8, 0, 2 },
-		{ "SET 6,C", &z::SETBR, 8, 0, 2 },
-		{ "SET 6,D", &z::SETBR, 8, 0, 2 },
-		{ "SET 6,E", &z::SETBR, 8, 0, 2 },
-		{ "SET 6,H", &z::SETBR, 8, 0, 2 },
-		{ "SET 6,L", &z::SETBR, 8, 0, 2 },
-		{ "SET 6,(HL)", &z::SETBR, 15, 0, 2 },
-		{ "SET 6,A", &z::SETBR, 8, 0, 2 },
-		{ "SET 7,B", &z::SETBR, 8, 0, 2 },
-		{ "SET 7,C", &z::SETBR, 8, 0, 2 },
-		{ "SET 7,D", &z::SETBR, 8, 0, 2 },
-		{ "SET 7,E", &z::SETBR, 8, 0, 2 },
-		{ "SET 7,H", &z::SETBR, 8, 0, 2 },
-		{ "SET 7,L", &z::SETBR, 8, 0, 2 },
-		{ "SET 7,(HL)", &z::SETBR, 15, 0, 2 },
-		{ "SET 7,A", &z::SETBR, 8, 0, 2 },
-
-		//IX Instruction Set
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "ADD IX,BC", &z::ADDIXSS, 15, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "ADD IX,DE", &z::ADDIXSS, 15, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "LD IX,0xhhll", &z::LDDDNN, 14, 0, 4 },
-		{ "LD (0xhhll),IX", &z::LDiNNIX, 20, 0, 4 },
-		{ "INC IX", &z::INCIX, 10, 0, 2 },
-		{ "INC IXH", &z::INCR, 8, 0, 2 },
-		{ "DEC IXH", &z::DECR, 8, 0, 2 },
-		{ "LD IXH,0xll", &z::LDRN, 11, 0, 3 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "ADD IX,IX", &z::ADDIXSS, 15, 0, 2 },
-		{ "LD IX,(0xhhll)", &z::LDIXiNN, 20, 0, 4 },
-		{ "DEC IX", &z::DECIX, 10, 0, 2 },
-		{ "INC IXL", &z::INCR, 8, 0, 2 },
-		{ "DEC IXL", &z::DECR, 8, 0, 2 },
-		{ "LD IXL,0xll", &z::LDRN, 11, 0, 3 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "INC (IX+0xll)", &z::INCR, 23, 0, 3 },
-		{ "DEC (IX+0xll)", &z::DECR, 23, 0, 3 },
-		{ "LD (IX+0xll),0xhh", &z::LDRN, 19, 0, 4 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "ADD IX,SP", &z::ADDIXSS, 15, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "LD B,B", &z::LDRR, 8, 0, 2 },
-		{ "LD B,C", &z::LDRR, 8, 0, 2 },
-		{ "LD B,D", &z::LDRR, 8, 0, 2 },
-		{ "LD B,E", &z::LDRR, 8, 0, 2 },
-		{ "LD B,IXH", &z::LDRR, 8, 0, 2 },
-		{ "LD B,IXL", &z::LDRR, 8, 0, 2 },
-		{ "LD B,(IX+0xll)", &z::LDRRi, 19, 0, 3 },
-		{ "LD B,A", &z::LDRR, 8, 0, 2 },
-		{ "LD C,B", &z::LDRR, 8, 0, 2 },
-		{ "LD C,C", &z::LDRR, 8, 0, 2 },
-		{ "LD C,D", &z::LDRR, 8, 0, 2 },
-		{ "LD C,E", &z::LDRR, 8, 0, 2 },
-		{ "LD C,IXH", &z::LDRR, 8, 0, 2 },
-		{ "LD C,IXL", &z::LDRR, 8, 0, 2 },
-		{ "LD C,(IX+0xll)", &z::LDRRi, 19, 0, 3 },
-		{ "LD C,A", &z::LDRR, 8, 0, 2 },
-		{ "LD D,B", &z::LDRR, 8, 0, 2 },
-		{ "LD D,C", &z::LDRR, 8, 0, 2 },
-		{ "LD D,D", &z::LDRR, 8, 0, 2 },
-		{ "LD D,E", &z::LDRR, 8, 0, 2 },
-		{ "LD D,IXH", &z::LDRR, 8, 0, 2 },
-		{ "LD D,IXL", &z::LDRR, 8, 0, 2 },
-		{ "LD D,(IX+0xll)", &z::LDRRi, 19, 0, 3 },
-		{ "LD D,A", &z::LDRR, 8, 0, 2 },
-		{ "LD E,B", &z::LDRR, 8, 0, 2 },
-		{ "LD E,C", &z::LDRR, 8, 0, 2 },
-		{ "LD E,D", &z::LDRR, 8, 0, 2 },
-		{ "LD E,E", &z::LDRR, 8, 0, 2 },
-		{ "LD E,IXH", &z::LDRR, 8, 0, 2 },
-		{ "LD E,IXL", &z::LDRR, 8, 0, 2 },
-		{ "LD E,(IX+0xll)", &z::LDRRi, 19, 0, 3 },
-		{ "LD E,A", &z::LDRR, 8, 0, 2 },
-		{ "LD IXH,B", &z::LDRR, 8, 0, 2 },
-		{ "LD IXH,C", &z::LDRR, 8, 0, 2 },
-		{ "LD IXH,D", &z::LDRR, 8, 0, 2 },
-		{ "LD IXH,E", &z::LDRR, 8, 0, 2 },
-		{ "LD IXH,IXH", &z::LDRR, 8, 0, 2 },
-		{ "LD IXH,IXL", &z::LDRR, 8, 0, 2 },
-		{ "LD H,(IX+0xll)", &z::LDRRi, 19, 0, 3 },
-		{ "LD IXH,A", &z::LDRR, 8, 0, 2 },
-		{ "LD IXL,B", &z::LDRR, 8, 0, 2 },
-		{ "LD IXL,C", &z::LDRR, 8, 0, 2 },
-		{ "LD IXL,D", &z::LDRR, 8, 0, 2 },
-		{ "LD IXL,E", &z::LDRR, 8, 0, 2 },
-		{ "LD IXL,IXH", &z::LDRR, 8, 0, 2 },
-		{ "LD IXL,IXL", &z::LDRR, 8, 0, 2 },
-		{ "LD L,(IX+0xll)", &z::LDRRi, 19, 0, 3 },
-		{ "LD IXL,A", &z::LDRR, 8, 0, 2 },
-		{ "LD (IX+0xll),B", &z::LDiRR, 19, 0, 3 },
-		{ "LD (IX+0xll),C", &z::LDiRR, 19, 0, 3 },
-		{ "LD (IX+0xll),D", &z::LDiRR, 19, 0, 3 },
-		{ "LD (IX+0xll),E", &z::LDiRR, 19, 0, 3 },
-		{ "LD (IX+0xll),H", &z::LDiRR, 19, 0, 3 },
-		{ "LD (IX+0xll),L", &z::LDiRR, 19, 0, 3 },
-		{ "HALT ", &z::HALT, 8, 0, 2 },
-		{ "LD (IX+0xll),A", &z::LDiRR, 19, 0, 3 },
-		{ "LD A,B", &z::LDRR, 8, 0, 2 },
-		{ "LD A,C", &z::LDRR, 8, 0, 2 },
-		{ "LD A,D", &z::LDRR, 8, 0, 2 },
-		{ "LD A,E", &z::LDRR, 8, 0, 2 },
-		{ "LD A,IXH", &z::LDRR, 8, 0, 2 },
-		{ "LD A,IXL", &z::LDRR, 8, 0, 2 },
-		{ "LD A,(IX+0xll)", &z::LDRRi, 19, 0, 3 },
-		{ "LD A,A", &z::LDRR, 8, 0, 2 },
-		{ "ADD A,B", &z::ADDR, 8, 0, 2 },
-		{ "ADD A,C", &z::ADDR, 8, 0, 2 },
-		{ "ADD A,D", &z::ADDR, 8, 0, 2 },
-		{ "ADD A,E", &z::ADDR, 8, 0, 2 },
-		{ "ADD A,IXH", &z::ADDR, 8, 0, 2 },
-		{ "ADD A,IXL", &z::ADDR, 8, 0, 2 },
-		{ "ADD A,(IX+0xll)", &z::ADDR, 19, 0, 3 },
-		{ "ADD A,A", &z::ADDR, 8, 0, 2 },
-		{ "ADC A,B", &z::ADCR, 8, 0, 2 },
-		{ "ADC A,C", &z::ADCR, 8, 0, 2 },
-		{ "ADC A,D", &z::ADCR, 8, 0, 2 },
-		{ "ADC A,E", &z::ADCR, 8, 0, 2 },
-		{ "ADC A,IXH", &z::ADCR, 8, 0, 2 },
-		{ "ADC A,IXL", &z::ADCR, 8, 0, 2 },
-		{ "ADC A,(IX+0xll)", &z::ADCR, 19, 0, 3 },
-		{ "ADC A,A", &z::ADCR, 8, 0, 2 },
-		{ "SUB A,B", &z::SUBR, 8, 0, 2 },
-		{ "SUB A,C", &z::SUBR, 8, 0, 2 },
-		{ "SUB A,D", &z::SUBR, 8, 0, 2 },
-		{ "SUB A,E", &z::SUBR, 8, 0, 2 },
-		{ "SUB A,IXH", &z::SUBR, 8, 0, 2 },
-		{ "SUB A,IXL", &z::SUBR, 8, 0, 2 },
-		{ "SUB A,(IX+0xll)", &z::SUBR, 19, 0, 3 },
-		{ "SUB A,A", &z::SUBR, 8, 0, 2 },
-		{ "SBC A,B", &z::SBCR, 8, 0, 2 },
-		{ "SBC A,C", &z::SBCR, 8, 0, 2 },
-		{ "SBC A,D", &z::SBCR, 8, 0, 2 },
-		{ "SBC A,E", &z::SBCR, 8, 0, 2 },
-		{ "SBC A,IXH", &z::SBCR, 8, 0, 2 },
-		{ "SBC A,IXL", &z::SBCR, 8, 0, 2 },
-		{ "SBC A,(IX+0xll)", &z::SBCR, 19, 0, 3 },
-		{ "SBC A,A", &z::SBCR, 8, 0, 2 },
-		{ "AND B", &z::ANDR, 8, 0, 2 },
-		{ "AND C", &z::ANDR, 8, 0, 2 },
-		{ "AND D", &z::ANDR, 8, 0, 2 },
-		{ "AND E", &z::ANDR, 8, 0, 2 },
-		{ "AND IXH", &z::ANDR, 8, 0, 2 },
-		{ "AND IXL", &z::ANDR, 8, 0, 2 },
-		{ "AND (IX+0xll)", &z::ANDR, 19, 0, 3 },
-		{ "AND A", &z::ANDR, 8, 0, 2 },
-		{ "XOR B", &z::XORR, 8, 0, 2 },
-		{ "XOR C", &z::XORR, 8, 0, 2 },
-		{ "XOR D", &z::XORR, 8, 0, 2 },
-		{ "XOR E", &z::XORR, 8, 0, 2 },
-		{ "XOR IXH", &z::XORR, 8, 0, 2 },
-		{ "XOR IXL", &z::XORR, 8, 0, 2 },
-		{ "XOR (IX+0xll)", &z::XORR, 19, 0, 3 },
-		{ "XOR A", &z::XORR, 8, 0, 2 },
-		{ "OR B", &z::ORR, 8, 0, 2 },
-		{ "OR C", &z::ORR, 8, 0, 2 },
-		{ "OR D", &z::ORR, 8, 0, 2 },
-		{ "OR E", &z::ORR, 8, 0, 2 },
-		{ "OR IXH", &z::ORR, 8, 0, 2 },
-		{ "OR IXL", &z::ORR, 8, 0, 2 },
-		{ "OR (IX+0xll)", &z::ORR, 19, 0, 3 },
-		{ "OR A", &z::ORR, 8, 0, 2 },
-		{ "CP B", &z::CPR, 8, 0, 2 },
-		{ "CP C", &z::CPR, 8, 0, 2 },
-		{ "CP D", &z::CPR, 8, 0, 2 },
-		{ "CP E", &z::CPR, 8, 0, 2 },
-		{ "CP IXH", &z::CPR, 8, 0, 2 },
-		{ "CP IXL", &z::CPR, 8, 0, 2 },
-		{ "CP (IX+0xll)", &z::CPR, 19, 0, 3 },
-		{ "CP A", &z::CPR, 8, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "POP IX", &z::POPIX, 14, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "EX (SP),IX", &z::EXiSPIX, 23, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "PUSH IX", &z::PUSHIX, 15, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "JP (IX)", &z::JPiIX, 8, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "LD SP,IX", &z::LDSPIX, 10, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-
-		//EXT Instruction Set
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "IN B,(C)", &z::INRiC, 12, 0, 2 },
-		{ "OUT (C),B", &z::OUTiCR, 12, 0, 2 },
-		{ "SBC HL,BC", &z::SBCHLSS, 15, 0, 2 },
-		{ "LD (0xhhll),BC", &z::LDiNNDD, 20, 0, 4 },
-		{ "NEG ", &z::NEG, 8, 0, 2 },
-		{ "RETN ", &z::RETN, 14, 0, 2 },
-		{ "IM 0 ", &z::IM0, 8, 0, 2 },
-		{ "LD I,A", &z::LDIA, 9, 0, 2 },
-		{ "IN C,(C)", &z::INRiC, 12, 0, 2 },
-		{ "OUT (C),C", &z::OUTiCR, 12, 0, 2 },
-		{ "ADC HL,BC", &z::ADCHLSS, 15, 0, 2 },
-		{ "LD BC,(0xhhll)", &z::LDDDiNN, 20, 0, 4 },
-		{ "NEG ", &z::NEG, 8, 0, 2 },
-		{ "RETI ", &z::RETI, 14, 0, 2 },
-		{ "IM 0", &z::IM0, 8, 0, 2 },
-		{ "LD R,A", &z::LDRA, 9, 0, 2 },
-		{ "IN D,(C)", &z::INRiC, 12, 0, 2 },
-		{ "OUT (C),D", &z::OUTiCR, 12, 0, 2 },
-		{ "SBC HL,DE", &z::SBCHLSS, 15, 0, 2 },
-		{ "LD (0xhhll),DE", &z::LDiNNDD, 20, 0, 4 },
-		{ "NEG ", &z::NEG, 8, 0, 2 },
-		{ "RETN ", &z::RETN, 14, 0, 2 },
-		{ "IM 1 ", &z::IM1, 8, 0, 2 },
-		{ "LD A,I", &z::LDAI, 9, 0, 2 },
-		{ "IN E,(C)", &z::INRiC, 12, 0, 2 },
-		{ "OUT (C),E", &z::OUTiCR, 12, 0, 2 },
-		{ "ADC HL,DE", &z::ADCHLSS, 15, 0, 2 },
-		{ "LD DE,(0xhhll)", &z::LDDDiNN, 20, 0, 4 },
-		{ "NEG ", &z::NEG, 8, 0, 2 },
-		{ "RETN ", &z::RETN, 14, 0, 2 },
-		{ "IM 2 ", &z::IM2, 8, 0, 2 },
-		{ "LD A,R", &z::LDAR, 9, 0, 2 },
-		{ "IN H,(C)", &z::INRiC, 12, 0, 2 },
-		{ "OUT (C),H", &z::OUTiCR, 12, 0, 2 },
-		{ "SBC HL,HL", &z::SBCHLSS, 15, 0, 2 },
-		{ "LD (0xhhll),HL", &z::LDiNNDD, 20, 0, 4 },
-		{ "NEG ", &z::NEG, 8, 0, 2 },
-		{ "RETN ", &z::RETN, 14, 0, 2 },
-		{ "IM 0 ", &z::IM0, 8, 0, 2 },
-		{ "RRD ", &z::RRD, 18, 0, 2 },
-		{ "IN L,(C)", &z::INRiC, 12, 0, 2 },
-		{ "OUT (C),L", &z::OUTiCR, 12, 0, 2 },
-		{ "ADC HL,HL", &z::ADCHLSS, 15, 0, 2 },
-		{ "LD HL,(0xhhll)", &z::LDDDiNN, 20, 0, 4 },
-		{ "NEG ", &z::NEG, 8, 0, 2 },
-		{ "RETN ", &z::RETN, 14, 0, 2 },
-		{ "IM 0", &z::IM0, 8, 0, 2 },
-		{ "RLD ", &z::RLD, 18, 0, 2 },
-		{ "IN (C)", &z::INiC, 12, 0, 2 },
-		{ "OUT (C),0", &z::OUTiC0, 12, 0, 2 },
-		{ "SBC HL,SP", &z::SBCHLSS, 15, 0, 2 },
-		{ "LD (0xhhll),SP", &z::LDiNNDD, 20, 0, 4 },
-		{ "NEG ", &z::NEG, 8, 0, 2 },
-		{ "RETN ", &z::RETN, 14, 0, 2 },
-		{ "IM 1 ", &z::IM1, 8, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "IN A,(C)", &z::INRiC, 12, 0, 2 },
-		{ "OUT (C),A", &z::OUTiCR, 12, 0, 2 },
-		{ "ADC HL,SP", &z::ADCHLSS, 15, 0, 2 },
-		{ "LD SP,(0xhhll)", &z::LDDDiNN, 40, 0, 4 },
-		{ "NEG ", &z::NEG, 8, 0, 2 },
-		{ "RETN ", &z::RETN, 14, 0, 2 },
-		{ "IM 2 ", &z::IM2, 8, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "LDI ", &z::LDI, 16, 0, 2 },
-		{ "CPI ", &z::CPI, 16, 0, 2 },
-		{ "INI ", &z::INI, 16, 0, 2 },
-		{ "OUTI ", &z::OUTI, 16, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "LDD ", &z::LDD, 16, 0, 2 },
-		{ "CPD ", &z::CPD, 16, 0, 2 },
-		{ "IND ", &z::IND, 16, 0, 2 },
-		{ "OUTD ", &z::OUTD, 16, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "LDIR ", &z::LDIR, 21, 16, 2 },
-		{ "CPIR ", &z::CPIR, 21, 16, 2 },
-		{ "INIR ", &z::INIR, 21, 16, 2 },
-		{ "OTIR ", &z::OTIR, 21, 16, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "LDDR ", &z::LDDR, 21, 16, 2 },
-		{ "CPDR ", &z::CPDR, 21, 16, 2 },
-		{ "INDR ", &z::INDR, 21, 16, 2 },
-		{ "OTDR ", &z::OTDR, 21, 16, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-
-		//IY Instruction Set
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "ADD IY,BC", &z::ADDIYSS, 15, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "ADD IY,DE", &z::ADDIYSS, 15, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "LD IY,0xhhll", &z::LDDDNN, 14, 0, 4 },
-		{ "LD (0xhhll),IY", &z::LDiNNIY, 20, 0, 4 },
-		{ "INC IY", &z::INCIY, 10, 0, 2 },
-		{ "INC IYH", &z::INCR, 8, 0, 2 },
-		{ "DEC IYH", &z::DECR, 8, 0, 2 },
-		{ "LD IYH,0xll", &z::LDRN, 11, 0, 3 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "ADD IY,IY", &z::ADDIYSS, 15, 0, 2 },
-		{ "LD IY,(0xhhll)", &z::LDIYiNN, 20, 0, 4 },
-		{ "DEC IY", &z::DECIY, 10, 0, 2 },
-		{ "INC IYL", &z::INCR, 8, 0, 2 },
-		{ "DEC IYL", &z::DECR, 8, 0, 2 },
-		{ "LD IYL,0xll", &z::LDRN, 11, 0, 3 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "INC (IY+0xll)", &z::INCR, 23, 0, 3 },
-		{ "DEC (IY+0xll)", &z::DECR, 23, 0, 3 },
-		{ "LD (IY+0xll),0xhh", &z::LDRN, 19, 0, 4 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "ADD IY,SP", &z::ADDIYSS, 15, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "LD B,B", &z::LDRR, 8, 0, 2 },
-		{ "LD B,C", &z::LDRR, 8, 0, 2 },
-		{ "LD B,D", &z::LDRR, 8, 0, 2 },
-		{ "LD B,E", &z::LDRR, 8, 0, 2 },
-		{ "LD B,IYH", &z::LDRR, 8, 0, 2 },
-		{ "LD B,IYL", &z::LDRR, 8, 0, 2 },
-		{ "LD B,(IY+0xll)", &z::LDRRi, 19, 0, 3 },
-		{ "LD B,A", &z::LDRR, 8, 0, 2 },
-		{ "LD C,B", &z::LDRR, 8, 0, 2 },
-		{ "LD C,C", &z::LDRR, 8, 0, 2 },
-		{ "LD C,D", &z::LDRR, 8, 0, 2 },
-		{ "LD C,E", &z::LDRR, 8, 0, 2 },
-		{ "LD C,IYH", &z::LDRR, 8, 0, 2 },
-		{ "LD C,IYL", &z::LDRR, 8, 0, 2 },
-		{ "LD C,(IY+0xll)", &z::LDRRi, 19, 0, 3 },
-		{ "LD C,A", &z::LDRR, 8, 0, 2 },
-		{ "LD D,B", &z::LDRR, 8, 0, 2 },
-		{ "LD D,C", &z::LDRR, 8, 0, 2 },
-		{ "LD D,D", &z::LDRR, 8, 0, 2 },
-		{ "LD D,E", &z::LDRR, 8, 0, 2 },
-		{ "LD D,IYH", &z::LDRR, 8, 0, 2 },
-		{ "LD D,IYL", &z::LDRR, 8, 0, 2 },
-		{ "LD D,(IY+0xll)", &z::LDRRi, 19, 0, 3 },
-		{ "LD D,A", &z::LDRR, 8, 0, 2 },
-		{ "LD E,B", &z::LDRR, 8, 0, 2 },
-		{ "LD E,C", &z::LDRR, 8, 0, 2 },
-		{ "LD E,D", &z::LDRR, 8, 0, 2 },
-		{ "LD E,E", &z::LDRR, 8, 0, 2 },
-		{ "LD E,IYH", &z::LDRR, 8, 0, 2 },
-		{ "LD E,IYL", &z::LDRR, 8, 0, 2 },
-		{ "LD E,(IY+0xll)", &z::LDRRi, 19, 0, 3 },
-		{ "LD E,A", &z::LDRR, 8, 0, 2 },
-		{ "LD IYH,B", &z::LDRR, 8, 0, 2 },
-		{ "LD IYH,C", &z::LDRR, 8, 0, 2 },
-		{ "LD IYH,D", &z::LDRR, 8, 0, 2 },
-		{ "LD IYH,E", &z::LDRR, 8, 0, 2 },
-		{ "LD IYH,IYH", &z::LDRR, 8, 0, 2 },
-		{ "LD IYH,IYL", &z::LDRR, 8, 0, 2 },
-		{ "LD H,(IY+0xll)", &z::LDRRi, 19, 0, 3 },
-		{ "LD IYH,A", &z::LDRR, 8, 0, 2 },
-		{ "LD IYL,B", &z::LDRR, 8, 0, 2 },
-		{ "LD IYL,C", &z::LDRR, 8, 0, 2 },
-		{ "LD IYL,D", &z::LDRR, 8, 0, 2 },
-		{ "LD IYL,E", &z::LDRR, 8, 0, 2 },
-		{ "LD IYL,IYH", &z::LDRR, 8, 0, 2 },
-		{ "LD IYL,IYL", &z::LDRR, 8, 0, 2 },
-		{ "LD L,(IY+0xll)", &z::LDRRi, 19, 0, 3 },
-		{ "LD IYL,A", &z::LDRR, 8, 0, 2 },
-		{ "LD (IY+0xll),B", &z::LDiRR, 19, 0, 3 },
-		{ "LD (IY+0xll),C", &z::LDiRR, 19, 0, 3 },
-		{ "LD (IY+0xll),D", &z::LDiRR, 19, 0, 3 },
-		{ "LD (IY+0xll),E", &z::LDiRR, 19, 0, 3 },
-		{ "LD (IY+0xll),H", &z::LDiRR, 19, 0, 3 },
-		{ "LD (IY+0xll),L", &z::LDiRR, 19, 0, 3 },
-		{ "HALT ", &z::HALT, 8, 0, 2 },
-		{ "LD (IY+0xll),A", &z::LDiRR, 19, 0, 3 },
-		{ "LD A,B", &z::LDRR, 8, 0, 2 },
-		{ "LD A,C", &z::LDRR, 8, 0, 2 },
-		{ "LD A,D", &z::LDRR, 8, 0, 2 },
-		{ "LD A,E", &z::LDRR, 8, 0, 2 },
-		{ "LD A,IYH", &z::LDRR, 8, 0, 2 },
-		{ "LD A,IYL", &z::LDRR, 8, 0, 2 },
-		{ "LD A,(IY+0xll)", &z::LDRRi, 19, 0, 3 },
-		{ "LD A,A", &z::LDRR, 8, 0, 2 },
-		{ "ADD A,B", &z::ADDR, 8, 0, 2 },
-		{ "ADD A,C", &z::ADDR, 8, 0, 2 },
-		{ "ADD A,D", &z::ADDR, 8, 0, 2 },
-		{ "ADD A,E", &z::ADDR, 8, 0, 2 },
-		{ "ADD A,IYH", &z::ADDR, 8, 0, 2 },
-		{ "ADD A,IYL", &z::ADDR, 8, 0, 2 },
-		{ "ADD A,(IY+0xll)", &z::ADDR, 19, 0, 3 },
-		{ "ADD A,A", &z::ADDR, 8, 0, 2 },
-		{ "ADC A,B", &z::ADCR, 8, 0, 2 },
-		{ "ADC A,C", &z::ADCR, 8, 0, 2 },
-		{ "ADC A,D", &z::ADCR, 8, 0, 2 },
-		{ "ADC A,E", &z::ADCR, 8, 0, 2 },
-		{ "ADC A,IYH", &z::ADCR, 8, 0, 2 },
-		{ "ADC A,IYL", &z::ADCR, 8, 0, 2 },
-		{ "ADC A,(IY+0xll)", &z::ADCR, 19, 0, 3 },
-		{ "ADC A,A", &z::ADCR, 8, 0, 2 },
-		{ "SUB A,B", &z::SUBR, 8, 0, 2 },
-		{ "SUB A,C", &z::SUBR, 8, 0, 2 },
-		{ "SUB A,D", &z::SUBR, 8, 0, 2 },
-		{ "SUB A,E", &z::SUBR, 8, 0, 2 },
-		{ "SUB A,IYH", &z::SUBR, 8, 0, 2 },
-		{ "SUB A,IYL", &z::SUBR, 8, 0, 2 },
-		{ "SUB A,(IY+0xll)", &z::SUBR, 19, 0, 3 },
-		{ "SUB A,A", &z::SUBR, 8, 0, 2 },
-		{ "SBC A,B", &z::SBCR, 8, 0, 2 },
-		{ "SBC A,C", &z::SBCR, 8, 0, 2 },
-		{ "SBC A,D", &z::SBCR, 8, 0, 2 },
-		{ "SBC A,E", &z::SBCR, 8, 0, 2 },
-		{ "SBC A,IYH", &z::SBCR, 8, 0, 2 },
-		{ "SBC A,IYL", &z::SBCR, 8, 0, 2 },
-		{ "SBC A,(IY+0xll)", &z::SBCR, 19, 0, 3 },
-		{ "SBC A,A", &z::SBCR, 8, 0, 2 },
-		{ "AND B", &z::ANDR, 8, 0, 2 },
-		{ "AND C", &z::ANDR, 8, 0, 2 },
-		{ "AND D", &z::ANDR, 8, 0, 2 },
-		{ "AND E", &z::ANDR, 8, 0, 2 },
-		{ "AND IYH", &z::ANDR, 8, 0, 2 },
-		{ "AND IYL", &z::ANDR, 8, 0, 2 },
-		{ "AND (IY+0xll)", &z::ANDR, 19, 0, 3 },
-		{ "AND A", &z::ANDR, 8, 0, 2 },
-		{ "XOR B", &z::XORR, 8, 0, 2 },
-		{ "XOR C", &z::XORR, 8, 0, 2 },
-		{ "XOR D", &z::XORR, 8, 0, 2 },
-		{ "XOR E", &z::XORR, 8, 0, 2 },
-		{ "XOR IYH", &z::XORR, 8, 0, 2 },
-		{ "XOR IYL", &z::XORR, 8, 0, 2 },
-		{ "XOR (IY+0xll)", &z::XORR, 19, 0, 3 },
-		{ "XOR A", &z::XORR, 8, 0, 2 },
-		{ "OR B", &z::ORR, 8, 0, 2 },
-		{ "OR C", &z::ORR, 8, 0, 2 },
-		{ "OR D", &z::ORR, 8, 0, 2 },
-		{ "OR E", &z::ORR, 8, 0, 2 },
-		{ "OR IYH", &z::ORR, 8, 0, 2 },
-		{ "OR IYL", &z::ORR, 8, 0, 2 },
-		{ "OR (IY+0xll)", &z::ORR, 19, 0, 3 },
-		{ "OR A", &z::ORR, 8, 0, 2 },
-		{ "CP B", &z::CPR, 8, 0, 2 },
-		{ "CP C", &z::CPR, 8, 0, 2 },
-		{ "CP D", &z::CPR, 8, 0, 2 },
-		{ "CP E", &z::CPR, 8, 0, 2 },
-		{ "CP IYH", &z::CPR, 8, 0, 2 },
-		{ "CP IYL", &z::CPR, 8, 0, 2 },
-		{ "CP (IY+0xll)", &z::CPR, 19, 0, 3 },
-		{ "CP A", &z::CPR, 8, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "POP IY", &z::POPIY, 14, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "EX (SP),IY", &z::EXiSPIY, 23, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "PUSH IY", &z::PUSHIY, 15, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "JP (IY)", &z::JPiIY, 8, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "LD SP,IY", &z::LDSPIY, 10, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-		{ "XXX ", &z::INVAL, 0, 0, 2 },
-
-		//IX BIT Instruction Set
-		{ "RLC (IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RLC (IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RLC (IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RLC (IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RLC (IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RLC (IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RLC (IX+0xll)", &z::RLCR, 23, 0, 4 },
-		{ "RLC (IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RRC (IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RRC (IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RRC (IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RRC (IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RRC (IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RRC (IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RRC (IX+0xll)", &z::RRCR, 23, 0, 4 },
-		{ "RRC (IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RL (IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RL (IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RL (IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RL (IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RL (IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RL (IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RL (IX+0xll)", &z::RLR, 23, 0, 4 },
-		{ "RL (IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RR (IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RR (IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RR (IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RR (IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RR (IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RR (IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RR (IX+0xll)", &z::RRR, 23, 0, 4 },
-		{ "RR (IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SLA (IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SLA (IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SLA (IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SLA (IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SLA (IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SLA (IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SLA (IX+0xll)", &z::SLAR, 23, 0, 4 },
-		{ "SLA (IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SRA (IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SRA (IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SRA (IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SRA (IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SRA (IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SRA (IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SRA (IX+0xll)", &z::SRAR, 23, 0, 4 },
-		{ "SRA (IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SLL (IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SLL (IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SLL (IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SLL (IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SLL (IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SLL (IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SLL (IX+0xll)", &z::SLLR, 23, 0, 4 },
-		{ "SLL (IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SRL (IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SRL (IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SRL (IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SRL (IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SRL (IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SRL (IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SRL (IX+0xll)", &z::SRLR, 23, 0, 4 },
-		{ "SRL (IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "BIT 0,(IX+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 0,(IX+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 0,(IX+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 0,(IX+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 0,(IX+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 0,(IX+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 0,(IX+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 0,(IX+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 1,(IX+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 1,(IX+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 1,(IX+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 1,(IX+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 1,(IX+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 1,(IX+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 1,(IX+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 1,(IX+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 2,(IX+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 2,(IX+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 2,(IX+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 2,(IX+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 2,(IX+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 2,(IX+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 2,(IX+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 2,(IX+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 3,(IX+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 3,(IX+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 3,(IX+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 3,(IX+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 3,(IX+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 3,(IX+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 3,(IX+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 3,(IX+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 4,(IX+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 4,(IX+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 4,(IX+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 4,(IX+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 4,(IX+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 4,(IX+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 4,(IX+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 4,(IX+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 5,(IX+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 5,(IX+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 5,(IX+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 5,(IX+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 5,(IX+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 5,(IX+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 5,(IX+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 5,(IX+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 6,(IX+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 6,(IX+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 6,(IX+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 6,(IX+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 6,(IX+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 6,(IX+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 6,(IX+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 6,(IX+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 7,(IX+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 7,(IX+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 7,(IX+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 7,(IX+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 7,(IX+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 7,(IX+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 7,(IX+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 7,(IX+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "RES 0,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 0,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 0,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 0,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 0,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 0,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 0,(IX+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 0,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RES 1,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 1,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 1,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 1,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 1,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 1,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 1,(IX+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 1,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RES 2,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 2,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 2,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 2,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 2,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 2,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 2,(IX+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 2,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RES 3,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 3,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 3,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 3,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 3,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 3,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 3,(IX+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 3,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RES 4,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 4,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 4,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 4,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 4,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 4,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 4,(IX+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 4,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RES 5,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 5,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 5,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 5,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 5,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 5,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 5,(IX+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 5,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RES 6,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 6,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 6,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 6,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 6,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 6,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 6,(IX+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 6,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RES 7,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 7,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 7,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 7,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 7,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 7,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 7,(IX+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 7,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 0,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 0,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 0,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 0,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 0,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 0,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 0,(IX+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 0,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 1,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 1,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 1,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 1,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 1,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 1,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 1,(IX+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 1,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 2,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 2,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 2,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 2,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 2,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 2,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 2,(IX+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 2,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 3,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 3,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 3,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 3,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 3,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 3,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 3,(IX+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 3,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 4,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 4,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 4,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 4,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 4,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 4,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 4,(IX+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 4,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 5,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 5,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 5,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 5,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 5,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 5,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 5,(IX+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 5,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 6,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 6,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 6,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 6,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 6,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 6,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 6,(IX+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 6,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 7,(IX+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 7,(IX+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 7,(IX+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 7,(IX+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 7,(IX+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 7,(IX+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 7,(IX+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 7,(IX+0xll),A", &z::UNDOC, 23, 0, 4 },
-
-		//IY BIT Instruction Set
-		{ "RLC (IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RLC (IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RLC (IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RLC (IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RLC (IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RLC (IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RLC (IY+0xll)", &z::RLCR, 23, 0, 4 },
-		{ "RLC (IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RRC (IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RRC (IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RRC (IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RRC (IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RRC (IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RRC (IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RRC (IY+0xll)", &z::RRCR, 23, 0, 4 },
-		{ "RRC (IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RL (IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RL (IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RL (IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RL (IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RL (IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RL (IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RL (IY+0xll)", &z::RLR, 23, 0, 4 },
-		{ "RL (IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RR (IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RR (IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RR (IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RR (IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RR (IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RR (IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RR (IY+0xll)", &z::RRR, 23, 0, 4 },
-		{ "RR (IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SLA (IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SLA (IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SLA (IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SLA (IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SLA (IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SLA (IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SLA (IY+0xll)", &z::SLAR, 23, 0, 4 },
-		{ "SLA (IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SRA (IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SRA (IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SRA (IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SRA (IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SRA (IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SRA (IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SRA (IY+0xll)", &z::SRAR, 23, 0, 4 },
-		{ "SRA (IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SLL (IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SLL (IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SLL (IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SLL (IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SLL (IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SLL (IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SLL (IY+0xll)", &z::SLLR, 23, 0, 4 },
-		{ "SLL (IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SRL (IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SRL (IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SRL (IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SRL (IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SRL (IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SRL (IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SRL (IY+0xll)", &z::SRLR, 23, 0, 4 },
-		{ "SRL (IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "BIT 0,(IY+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 0,(IY+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 0,(IY+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 0,(IY+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 0,(IY+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 0,(IY+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 0,(IY+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 0,(IY+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 1,(IY+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 1,(IY+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 1,(IY+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 1,(IY+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 1,(IY+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 1,(IY+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 1,(IY+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 1,(IY+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 2,(IY+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 2,(IY+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 2,(IY+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 2,(IY+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 2,(IY+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 2,(IY+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 2,(IY+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 2,(IY+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 3,(IY+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 3,(IY+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 3,(IY+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 3,(IY+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 3,(IY+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 3,(IY+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 3,(IY+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 3,(IY+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 4,(IY+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 4,(IY+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 4,(IY+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 4,(IY+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 4,(IY+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 4,(IY+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 4,(IY+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 4,(IY+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 5,(IY+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 5,(IY+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 5,(IY+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 5,(IY+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 5,(IY+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 5,(IY+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 5,(IY+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 5,(IY+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 6,(IY+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 6,(IY+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 6,(IY+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 6,(IY+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 6,(IY+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 6,(IY+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 6,(IY+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 6,(IY+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 7,(IY+0xll),B", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 7,(IY+0xll),C", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 7,(IY+0xll),D", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 7,(IY+0xll),E", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 7,(IY+0xll),H", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 7,(IY+0xll),L", &z::UNDOC, 20, 0, 4 },
-		{ "BIT 7,(IY+0xll)", &z::BITBR, 20, 0, 4 },
-		{ "BIT 7,(IY+0xll),A", &z::UNDOC, 20, 0, 4 },
-		{ "RES 0,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 0,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 0,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 0,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 0,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 0,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 0,(IY+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 0,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RES 1,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 1,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 1,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 1,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 1,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 1,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 1,(IY+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 1,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RES 2,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 2,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 2,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 2,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 2,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 2,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 2,(IY+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 2,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RES 3,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 3,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 3,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 3,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 3,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 3,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 3,(IY+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 3,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RES 4,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 4,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 4,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 4,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 4,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 4,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 4,(IY+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 4,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RES 5,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 5,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 5,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 5,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 5,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 5,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 5,(IY+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 5,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RES 6,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 6,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 6,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 6,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 6,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 6,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 6,(IY+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 6,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "RES 7,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "RES 7,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "RES 7,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "RES 7,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "RES 7,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "RES 7,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "RES 7,(IY+0xll)", &z::RESBR, 23, 0, 4 },
-		{ "RES 7,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 0,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 0,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 0,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 0,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 0,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 0,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 0,(IY+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 0,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 1,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 1,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 1,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 1,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 1,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 1,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 1,(IY+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 1,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 2,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 2,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 2,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 2,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 2,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 2,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 2,(IY+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 2,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 3,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 3,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 3,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 3,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 3,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 3,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 3,(IY+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 3,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 4,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 4,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 4,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 4,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 4,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 4,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 4,(IY+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 4,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 5,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 5,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 5,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 5,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 5,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 5,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 5,(IY+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 5,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 6,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 6,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 6,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 6,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 6,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 6,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 6,(IY+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 6,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-		{ "SET 7,(IY+0xll),B", &z::UNDOC, 23, 0, 4 },
-		{ "SET 7,(IY+0xll),C", &z::UNDOC, 23, 0, 4 },
-		{ "SET 7,(IY+0xll),D", &z::UNDOC, 23, 0, 4 },
-		{ "SET 7,(IY+0xll),E", &z::UNDOC, 23, 0, 4 },
-		{ "SET 7,(IY+0xll),H", &z::UNDOC, 23, 0, 4 },
-		{ "SET 7,(IY+0xll),L", &z::UNDOC, 23, 0, 4 },
-		{ "SET 7,(IY+0xll)", &z::SETBR, 23, 0, 4 },
-		{ "SET 7,(IY+0xll),A", &z::UNDOC, 23, 0, 4 },
-	};
 }
 
 Z80A::~Z80A()
@@ -1849,77 +3691,911 @@ Z80A::~Z80A()
 }
 
 //Externat Signal Functions
-//Clock function extract and execute an entire Istruction from memory if cycles = 0
-
+//Clock function is a compatibility shim over step(): it executes an entire Istruction
+//on its first clock tick, then counts down the remaining ticks
 bool Z80A::clock()
 {
-	if (cycles == 0)
+	if (ticks == 0)
+		ticks = step();
+
+	ticks--;
+	   	  
+	return true;
+}
+
+//Step function executes one entire Instruction (or Interrupt acknowledge) and
+//returns the number of clock cycles it takes
+int Z80A::step()
+{
+	// Check if theres INT or NMI pending ----------------------------------
+	if (nmi_latch)
+	{
+		NMIEXEC();
+	}
+	else if (!(irq_latch && IRQEXEC()))
 	{
-		// Check if theres INT or NMI pending ----------------------------------
-		if (nmi_latch) { NMIEXEC(); cycles--; return true; }
-		if (irq_latch) { IRQEXEC(); cycles--; return true; }
-		
 		//Read First 4 Byte From Memory
-		OPB(0) = memRd(PC_);
-		OPB(1) = memRd(PC_ + 1);
-		OPB(2) = memRd(PC_ + 2);
-		OPB(3) = memRd(PC_ + 3);
+		fetch();
 		
-		cbprefix = false;
-		ddprefix = false;
-		fdprefix = false;
-		edprefix = false;
-		ddcbprefix = false;
-		fdcbprefix = false;
+		decode();
+		execute();
+	}
 
-		//Select Instruction Group
-		// 0 - MAIN Instruction Set
-		// 1 - BIT Instruction Set - CB Prefix
-		// 2 - IX Instruction Set - DD Prefix
-		// 3 - EXT Instruction Set - ED Prefix
-		// 4 - IY Instruction Set - FD Prefix
-		// 5 - IX BIT Instruction Set - DD CB Prefix
-		// 5 - IY BIT Instruction Set - FD CB Prefix
-		switch (OPB(0))
+	nCycleCounter += cycles;
+
+	//DEBUG ONLY
+	bOpcodeComplete = true;
+
+	return cycles;
+}
+
+//Run function executes entire Instructions until at least budgetCycles clock cycles
+//are consumed, Interrupts are checked between Instructions. Returns the number of
+//clock cycles actually consumed
+int Z80A::run(int budgetCycles)
+{
+	uint64_t nStartCycle = nCycleCounter;
+	nRunEnd = nStartCycle + budgetCycles;
+
+	//Polled Ports can change between two runs (Controllers), start probing idle loops again
+	bIdleDirty = true;
+
+	if (cpuCore == CpuCore::THREADED)
+		runThreaded();
+	else if (cpuCore != CpuCore::INTERPRETER)
+		runBlocks();
+	else
+	{
+		while (nCycleCounter < nRunEnd)
+			step();
+	}
+
+	nRunEnd = 0;
+
+	return (int)(nCycleCounter - nStartCycle);
+}
+
+//Bring the end of the run() in progress forward to the given Cycle, e.g. when an I/O access moves
+//the next event of a device earlier. Instructions starting before it are still executed
+void Z80A::LimitRun(uint64_t nCycle)
+{
+	if ((nRunEnd != 0) && (nCycle < nRunEnd))
+		nRunEnd = nCycle;
+}
+
+//Select the Core used by run() to execute Instructions
+void Z80A::SetCore(CpuCore core)
+{
+	cpuCore = core;
+	blockCache.clear();
+
+	//The Differential Mode shadow CPU runs the Interpreter on the same Bus
+	if (core == CpuCore::DIFFERENTIAL)
+	{
+		pShadow = std::make_unique<Z80A>();
+		pShadow->ConnectBus(sms);
+		pDiffBus = std::make_unique<DIFFBUS>();
+	}
+	else
+	{
+		pShadow.reset();
+		pDiffBus.reset();
+	}
+}
+
+//Fetch the 4 Opcode bytes at PC, straight from the Memory Page when they lie within one page.
+//Returns the first Opcode byte
+inline uint8_t Z80A::fetch()
+{
+	//Differential Mode, the shadow CPU decodes the bytes read before the cached Instruction ran
+	if (pDiff != nullptr)
+	{
+		opcode = pDiff->fetch;
+		return OPB(0);
+	}
+
+	const uint8_t* p = sms->GetFetchPtr(PC_);
+
+	if (p != nullptr)
+	{
+		std::memcpy(opcode.data(), p, 4);
+		return p[0];
+	}
+
+	OPB(0) = memRd(PC_);
+	OPB(1) = memRd(PC_ + 1);
+	OPB(2) = memRd(PC_ + 2);
+	OPB(3) = memRd(PC_ + 3);
+
+	return OPB(0);
+}
+
+//Decode the Opcode read in opcode[], select Instruction and Prefix Flags
+void Z80A::decode()
+{
+	cbprefix = false;
+	ddprefix = false;
+	fdprefix = false;
+	edprefix = false;
+	ddcbprefix = false;
+	fdcbprefix = false;
+
+	//Select Instruction Group
+	// 0 - MAIN Instruction Set
+	// 1 - BIT Instruction Set - CB Prefix
+	// 2 - IX Instruction Set - DD Prefix
+	// 3 - EXT Instruction Set - ED Prefix
+	// 4 - IY Instruction Set - FD Prefix
+	// 5 - IX BIT Instruction Set - DD CB Prefix
+	// 5 - IY BIT Instruction Set - FD CB Prefix
+	switch (OPB(0))
+	{
+	case 0xcb: indexOp = OPB(1) + 0x100; cbprefix = true; break;
+	case 0xdd: indexOp = (OPB(1) != 0xcb) ? (OPB(1) + 0x200) : (OPB(3) + 0x500);
+						 (OPB(1) != 0xcb) ? ddprefix = true : ddcbprefix = true;
+						 break;
+	case 0xed: indexOp = OPB(1) + 0x300; edprefix = true; break;
+	case 0xfd: indexOp = (OPB(1) != 0xcb) ? (OPB(1) + 0x400) : (OPB(3) + 0x600);
+						 (OPB(1) != 0xcb) ? fdprefix = true : fdcbprefix = true;
+						 break;
+	default:
+		indexOp = OPB(0);
+	}
+}
+
+//Execute the decoded Instruction and set the number of clock cycles it takes
+void Z80A::execute()
+{
+	//Increment PC accordingly to lenght
+	PC_ += instSet[indexOp].lenght;
+
+	//Increment R Register according to Opcode Prefix
+	// No Prefix:	R = R + 1
+	// Prefix:		R = R + 2
+	// Register R bit 7 is not changed by the operation
+	uint8_t bit = R_ & 0x80;
+	(indexOp <= 0xff) ? R_++ : R_ += 2;
+	R_ = bit + (R_ & 0x7f);
+
+	//Executes Opcode
+	bool bResult = (this->*instSet[indexOp].operate)();
+
+	//Set the number of cycles per current Opcode
+	cycles = (bResult) ? instSet[indexOp].cycles1 : instSet[indexOp].cycles2;
+
+	nInstrCounter++;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//                                         Decoded Block Cache
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//Run Instructions from the Decoded Block Cache. Code running from Cartridge ROM is decoded
+//once in basic blocks, cached by ROM address (so by bank and address) and then executed
+//calling the cached Handlers, without fetching and decoding again. Code running from RAM
+//falls back to the interpreter. Runs up to the end of the current run()
+void Z80A::runBlocks()
+{
+	uint32_t romaddr;
+	BLOCK* pPrev = nullptr;					//Block just run, linked to the next one
+
+	while (nCycleCounter < nRunEnd)
+	{
+		//Interrupts go thru the Interpreter
+		if (nmi_latch || irq_latch)
 		{
-		case 0xcb: indexOp = OPB(1) + 0x100; cbprefix = true; break;
-		case 0xdd: indexOp = (OPB(1) != 0xcb) ? (OPB(1) + 0x200) : (OPB(3) + 0x500);
-							 (OPB(1) != 0xcb) ? ddprefix = true : ddcbprefix = true;
-							 break;
-		case 0xed: indexOp = OPB(1) + 0x300; edprefix = true; break;
-		case 0xfd: indexOp = (OPB(1) != 0xcb) ? (OPB(1) + 0x400) : (OPB(3) + 0x600);
-							 (OPB(1) != 0xcb) ? fdprefix = true : fdcbprefix = true;
-							 break;
-		default:
-			indexOp = OPB(0);
+			step();
+			pPrev = nullptr;
+			continue;
+		}
+
+		uint32_t nMapGeneration = sms->GetMapGeneration();
+		BLOCK* pBlock;
+
+		//Follow the link of the previous Block, the same PC with the same Memory Map is the same Block
+		if ((pPrev != nullptr) && (pPrev->pNext != nullptr) && (pPrev->nNextPC == PC_) && (pPrev->nNextGeneration == nMapGeneration))
+		{
+			pBlock = pPrev->pNext;
+		}
+		else
+		{
+			//Code not running from ROM goes thru the Interpreter
+			if (!sms->GetRomAddress(PC_, romaddr))
+			{
+				step();
+				pPrev = nullptr;
+				continue;
+			}
+
+			//Get the Block starting at current ROM Address, decode it if it's not cached yet
+			auto it = blockCache.find(romaddr);
+			if (it == blockCache.end())
+				it = blockCache.emplace(romaddr, decodeBlock(PC_, romaddr)).first;
+
+			pBlock = &it->second;
+			if (pPrev != nullptr)
+			{
+				pPrev->pNext = pBlock;
+				pPrev->nNextPC = PC_;
+				pPrev->nNextGeneration = nMapGeneration;
+			}
+		}
+
+		pPrev = nullptr;
+		if (pBlock->ops.empty())
+		{
+			step();
+			continue;
 		}
 
-		//Increment PC accordingly to lenght
-		PC_ += instSet[indexOp].lenght;
+		uint16_t nStartPC = PC_;
+		bool bDiverged = false;
+
+		for (const DECODED& op : pBlock->ops)
+		{
+			//Leave the Block if the previous Instruction jumped or if an Interrupt is pending
+			if ((PC_ != (uint16_t)(nStartPC + op.offset)) || nmi_latch || irq_latch)
+				break;
+
+			if (cpuCore == CpuCore::DIFFERENTIAL)
+				bDiverged = !diffExecute(op);
+			else
+				executeDecoded(op);
+
+			//Leave the Block if the budget is consumed or the Memory Map changed
+			if (bDiverged || (nCycleCounter >= nRunEnd) || (nMapGeneration != sms->GetMapGeneration()))
+				break;
+		}
+
+		//Drop the Blocks after a divergence, they are decoded again on their next execution.
+		//The whole cache goes, other Blocks can be linked to the diverging one
+		if (bDiverged)
+			blockCache.clear();
+		else
+			pPrev = pBlock;
+	}
+}
+
+//Execute a cached Instruction, the same as execute() with the decode() results taken
+//from the Block
+inline void Z80A::executeDecoded(const DECODED& op)
+{
+	opcode = op.opcode;
+	indexOp = op.indexOp;
+
+	//Prefix Flags from the Instruction Group, see decode()
+	uint8_t group = op.indexOp >> 8;
+	cbprefix = (group == 1);
+	ddprefix = (group == 2);
+	edprefix = (group == 3);
+	fdprefix = (group == 4);
+	ddcbprefix = (group == 5);
+	fdcbprefix = (group == 6);
+
+	PC_ += op.lenght;
 
-		//Increment R Register according to Opcode Prefix
-		// No Prefix:	R = R + 1
-		// Prefix:		R = R + 2
-		// Register R bit 7 is not changed by the operation
-		uint8_t bit = R_ & 0x80;
-		(indexOp <= 0xff) ? R_++ : R_ += 2;
-		R_ = bit + (R_ & 0x7f);
+	uint8_t bit = R_ & 0x80;
+	(group == 0) ? R_++ : R_ += 2;
+	R_ = bit + (R_ & 0x7f);
 
-		//Executes Opcode
-		bool bResult = (this->*instSet[indexOp].operate)();
+	cycles = ((this->*op.operate)()) ? op.cycles1 : op.cycles2;
 
-		//Set the number of cycles per current Opcode
-		cycles = (bResult) ? instSet[indexOp].cycles1 : instSet[indexOp].cycles2;
+	nInstrCounter++;
+	nCycleCounter += cycles;
+	bOpcodeComplete = true;
+}
+
+//Differential Mode, execute a cached Instruction recording its Bus accesses, then run the same
+//Instruction thru step() on the shadow CPU from the same starting state, replaying them. Returns
+//false and logs both states if Registers or Cycle Counter differ
+bool Z80A::diffExecute(const DECODED& op)
+{
+	DIFFBUS& bus = *pDiffBus;
+	uint16_t nPC = PC_;
+
+	bus.clear();
+	for (int i = 0; i < 4; i++)
+		bus.fetch[i] = memRd(PC_ + i);
+	pShadow->copyState(*this);
+
+	bus.bReplay = false;
+	pDiff = &bus;
+	executeDecoded(op);
+	pDiff = nullptr;
+
+	bus.bReplay = true;
+	pShadow->pDiff = &bus;
+	pShadow->step();
+	pShadow->pDiff = nullptr;
+
+	const Z80A& ref = *pShadow;
+	if ((AF_ == ref.AF_) && (BC_ == ref.BC_) && (DE_ == ref.DE_) && (HL_ == ref.HL_) &&
+		(IX_ == ref.IX_) && (IY_ == ref.IY_) && (SP_ == ref.SP_) && (PC_ == ref.PC_) &&
+		(nCycleCounter == ref.nCycleCounter))
+		return true;
+
+	LOG_F(ERROR, "CPU - Block Cache diverges from the Interpreter at %.4X [%.2X %.2X %.2X %.2X]", nPC, bus.fetch[0], bus.fetch[1], bus.fetch[2], bus.fetch[3]);
+	LOG_F(ERROR, "CPU - Block:  AF %.4X BC %.4X DE %.4X HL %.4X IX %.4X IY %.4X SP %.4X PC %.4X Cycles %llu",
+		AF_, BC_, DE_, HL_, IX_, IY_, SP_, PC_, (unsigned long long)nCycleCounter);
+	LOG_F(ERROR, "CPU - Interp: AF %.4X BC %.4X DE %.4X HL %.4X IX %.4X IY %.4X SP %.4X PC %.4X Cycles %llu",
+		ref.AF_, ref.BC_, ref.DE_, ref.HL_, ref.IX_, ref.IY_, ref.SP_, ref.PC_, (unsigned long long)ref.nCycleCounter);
+
+	return false;
+}
+
+//Copy the whole CPU state, Registers, Interrupt latches, Counters and Idle Loop probe included
+void Z80A::copyState(const Z80A& cpu)
+{
+	af = cpu.af;	af1 = cpu.af1;
+	bc = cpu.bc;	bc1 = cpu.bc1;
+	de = cpu.de;	de1 = cpu.de1;
+	hl = cpu.hl;	hl1 = cpu.hl1;
+	ir = cpu.ir;	wz = cpu.wz;
+	ix = cpu.ix;	iy = cpu.iy;
+	sp = cpu.sp;	pc = cpu.pc;
+
+	intmode = cpu.intmode;
+	bIFF1 = cpu.bIFF1;
+	bIFF2 = cpu.bIFF2;
+	bHalt = cpu.bHalt;
+	nmi_latch = cpu.nmi_latch;
+	irq_latch = cpu.irq_latch;
+
+	nCycleCounter = cpu.nCycleCounter;
+	nInstrCounter = cpu.nInstrCounter;
+	nRunEnd = cpu.nRunEnd;
+
+	idleState = cpu.idleState;
+	nIdlePC = cpu.nIdlePC;
+	nIdleCycle = cpu.nIdleCycle;
+	nIdleInstr = cpu.nIdleInstr;
+	nIdleR = cpu.nIdleR;
+	nIdleGeneration = cpu.nIdleGeneration;
+	bIdleDirty = cpu.bIdleDirty;
+	bIdleVdp = cpu.bIdleVdp;
+	bIdleStatus = cpu.bIdleStatus;
+}
+
+//Reset the Bus journal before the next Instruction
+void Z80A::DIFFBUS::clear()
+{
+	for (uint16_t addr : memTouched)
+		memFlags[addr] = 0;
+
+	memTouched.clear();
+	ioRead.clear();
+	query.clear();
+	nIoRead = 0;
+	nQuery = 0;
+}
+
+//Decode a basic Block starting at addr, mapped in ROM at romaddr. The Block ends on the
+//first Instruction that can change the Program Counter or that leaves the 1K page of addr.
+//Blocks are looked up by their first ROM address only, so a Block crossing a page (and then
+//a Mapper Slot boundary at 0x0400, 0x4000 or 0x8000) would keep stale bytes after a remap.
+Z80A::BLOCK Z80A::decodeBlock(uint16_t addr, uint32_t romaddr)
+{
+	BLOCK block;
+	uint16_t offset = 0;
+	uint32_t lastaddr;
+
+	while (block.ops.size() < MAXBLOCKLENGHT)
+	{
+		uint16_t pc = addr + offset;
+
+		DECODED op;
+		for (int i = 0; i < 4; i++)
+			op.opcode[i] = memRd(pc + i);
+
+		opcode = op.opcode;
+		decode();
+		op.operate = instSet[indexOp].operate;
+		op.indexOp = indexOp;
+		op.cycles1 = instSet[indexOp].cycles1;
+		op.cycles2 = instSet[indexOp].cycles2;
+		op.lenght = instSet[indexOp].lenght;
+		op.offset = (uint8_t)offset;
+
+		//The whole Instruction must lie in the same 1K page, mapped contiguously in ROM
+		uint8_t len = instSet[indexOp].lenght;
+		if (((uint16_t)(pc + len - 1) & 0xfc00) != (addr & 0xfc00))
+			break;
+
+		if (!sms->GetRomAddress(pc + len - 1, lastaddr) || (lastaddr != romaddr + offset + len - 1))
+			break;
+
+		block.ops.push_back(op);
+		offset += len;
+
+		if (isBlockEnd(indexOp))
+			break;
 	}
 
-	cycles--;
-	nCycleCounter++;
+	return block;
+}
+
+//Check if the Instruction can change the Program Counter or stop the CPU
+bool Z80A::isBlockEnd(uint16_t index)
+{
+	auto operate = instSet[index].operate;
 
-	//DEBUG ONLY
-	if (cycles == 0)
+	return	(operate == &Z80A::JPNN)	|| (operate == &Z80A::JPCCNN)	|| (operate == &Z80A::JRE)		||
+			(operate == &Z80A::JRCE)	|| (operate == &Z80A::JRNCE)	|| (operate == &Z80A::JRZE)		||
+			(operate == &Z80A::JRNZE)	|| (operate == &Z80A::JPiHL)	|| (operate == &Z80A::JPiIX)	||
+			(operate == &Z80A::JPiIY)	|| (operate == &Z80A::DJNZE)	|| (operate == &Z80A::CALLNN)	||
+			(operate == &Z80A::CALLCCNN)|| (operate == &Z80A::RET)		|| (operate == &Z80A::RETCC)	||
+			(operate == &Z80A::RETI)	|| (operate == &Z80A::RETN)		|| (operate == &Z80A::RSTP)		||
+			(operate == &Z80A::HALT)	|| (operate == &Z80A::LDIR)		|| (operate == &Z80A::LDDR)		||
+			(operate == &Z80A::CPIR)	|| (operate == &Z80A::CPDR)		|| (operate == &Z80A::INIR)		||
+			(operate == &Z80A::INDR)	|| (operate == &Z80A::OTIR)		|| (operate == &Z80A::OTDR)		||
+			(operate == &Z80A::INVAL);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//                                         Threaded Interpreter
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//The Threaded Interpreter dispatches on the first Opcode byte thru a table of labels (computed goto)
+//when the compiler supports it, or thru a plain switch otherwise. The most frequent unprefixed Opcodes
+//have their own Handler with register fields resolved at compile time, everything else (prefixed
+//Opcodes included) goes thru the generic decode() and execute() path.
+#if defined(__GNUC__) || defined(__clang__)
+#define THREADED_COMPUTED_GOTO
+#endif
+
+#ifdef THREADED_COMPUTED_GOTO
+#define DISPATCH(x)			goto *dispatchTable[x];
+#define OPCODE(x)			op_##x:
+#define OPGENERIC			op_generic:
+#else
+#define DISPATCH(x)			switch (x)
+#define OPCODE(x)			case x:
+#define OPGENERIC			default:
+#endif
+
+//Specialized Handler epilogue, clock cycles always come from the Instruction Table
+#define OPNEXT(x, len)		{ PC_ += len; cycles = instSet[x].cycles1; goto opcomplete; }
+#define OPBRANCH(x, taken)	{ cycles = (taken) ? instSet[x].cycles1 : instSet[x].cycles2; goto opcomplete; }
+
+//Run Instructions thru the Threaded Interpreter up to the end of the current run()
+void Z80A::runThreaded()
+{
+	int8_t e;
+
+#ifdef THREADED_COMPUTED_GOTO
+	static const void* const dispatchTable[256] =
+	{
+		&&op_0x00, &&op_0x01, &&op_0x02, &&op_0x03, &&op_0x04, &&op_0x05, &&op_0x06, &&op_generic, &&op_generic, &&op_generic, &&op_0x0a, &&op_0x0b, &&op_0x0c, &&op_0x0d, &&op_0x0e, &&op_generic,
+		&&op_0x10, &&op_0x11, &&op_0x12, &&op_0x13, &&op_0x14, &&op_0x15, &&op_0x16, &&op_generic, &&op_0x18, &&op_generic, &&op_0x1a, &&op_0x1b, &&op_0x1c, &&op_0x1d, &&op_0x1e, &&op_generic,
+		&&op_0x20, &&op_0x21, &&op_0x22, &&op_0x23, &&op_0x24, &&op_0x25, &&op_0x26, &&op_generic, &&op_0x28, &&op_generic, &&op_0x2a, &&op_0x2b, &&op_0x2c, &&op_0x2d, &&op_0x2e, &&op_generic,
+		&&op_0x30, &&op_0x31, &&op_0x32, &&op_0x33, &&op_0x34, &&op_0x35, &&op_0x36, &&op_generic, &&op_0x38, &&op_generic, &&op_0x3a, &&op_0x3b, &&op_0x3c, &&op_0x3d, &&op_0x3e, &&op_generic,
+		&&op_0x40, &&op_0x41, &&op_0x42, &&op_0x43, &&op_0x44, &&op_0x45, &&op_0x46, &&op_0x47, &&op_0x48, &&op_0x49, &&op_0x4a, &&op_0x4b, &&op_0x4c, &&op_0x4d, &&op_0x4e, &&op_0x4f,
+		&&op_0x50, &&op_0x51, &&op_0x52, &&op_0x53, &&op_0x54, &&op_0x55, &&op_0x56, &&op_0x57, &&op_0x58, &&op_0x59, &&op_0x5a, &&op_0x5b, &&op_0x5c, &&op_0x5d, &&op_0x5e, &&op_0x5f,
+		&&op_0x60, &&op_0x61, &&op_0x62, &&op_0x63, &&op_0x64, &&op_0x65, &&op_0x66, &&op_0x67, &&op_0x68, &&op_0x69, &&op_0x6a, &&op_0x6b, &&op_0x6c, &&op_0x6d, &&op_0x6e, &&op_0x6f,
+		&&op_0x70, &&op_0x71, &&op_0x72, &&op_0x73, &&op_0x74, &&op_0x75, &&op_generic, &&op_0x77, &&op_0x78, &&op_0x79, &&op_0x7a, &&op_0x7b, &&op_0x7c, &&op_0x7d, &&op_0x7e, &&op_0x7f,
+		&&op_0x80, &&op_0x81, &&op_0x82, &&op_0x83, &&op_0x84, &&op_0x85, &&op_0x86, &&op_0x87, &&op_0x88, &&op_0x89, &&op_0x8a, &&op_0x8b, &&op_0x8c, &&op_0x8d, &&op_0x8e, &&op_0x8f,
+		&&op_0x90, &&op_0x91, &&op_0x92, &&op_0x93, &&op_0x94, &&op_0x95, &&op_0x96, &&op_0x97, &&op_0x98, &&op_0x99, &&op_0x9a, &&op_0x9b, &&op_0x9c, &&op_0x9d, &&op_0x9e, &&op_0x9f,
+		&&op_0xa0, &&op_0xa1, &&op_0xa2, &&op_0xa3, &&op_0xa4, &&op_0xa5, &&op_0xa6, &&op_0xa7, &&op_0xa8, &&op_0xa9, &&op_0xaa, &&op_0xab, &&op_0xac, &&op_0xad, &&op_0xae, &&op_0xaf,
+		&&op_0xb0, &&op_0xb1, &&op_0xb2, &&op_0xb3, &&op_0xb4, &&op_0xb5, &&op_0xb6, &&op_0xb7, &&op_0xb8, &&op_0xb9, &&op_0xba, &&op_0xbb, &&op_0xbc, &&op_0xbd, &&op_0xbe, &&op_0xbf,
+		&&op_generic, &&op_0xc1, &&op_0xc2, &&op_0xc3, &&op_generic, &&op_0xc5, &&op_0xc6, &&op_0xc7, &&op_generic, &&op_0xc9, &&op_0xca, &&op_generic, &&op_generic, &&op_0xcd, &&op_0xce, &&op_0xcf,
+		&&op_generic, &&op_0xd1, &&op_0xd2, &&op_0xd3, &&op_generic, &&op_0xd5, &&op_0xd6, &&op_0xd7, &&op_generic, &&op_generic, &&op_0xda, &&op_0xdb, &&op_generic, &&op_generic, &&op_0xde, &&op_0xdf,
+		&&op_generic, &&op_0xe1, &&op_0xe2, &&op_generic, &&op_generic, &&op_0xe5, &&op_0xe6, &&op_0xe7, &&op_generic, &&op_generic, &&op_0xea, &&op_0xeb, &&op_generic, &&op_generic, &&op_0xee, &&op_0xef,
+		&&op_generic, &&op_0xf1, &&op_0xf2, &&op_0xf3, &&op_generic, &&op_0xf5, &&op_0xf6, &&op_0xf7, &&op_generic, &&op_generic, &&op_0xfa, &&op_0xfb, &&op_generic, &&op_generic, &&op_0xfe, &&op_0xff
+	};
+#endif
+
+	while (nCycleCounter < nRunEnd)
+	{
+		//Interrupts go thru the generic Interpreter
+		if (nmi_latch || irq_latch)
+		{
+			step();
+			continue;
+		}
+
+		uint8_t op = fetch();
+
+		DISPATCH(op)
+		{
+		OPCODE(0x00)	OPNEXT(0x00, 1)
+		OPCODE(0x01)	BC_ = OPW(1); OPNEXT(0x01, 3)
+		OPCODE(0x02)	memWr(BC_, A_); OPNEXT(0x02, 1)
+		OPCODE(0x03)	BC_++; OPNEXT(0x03, 1)
+		OPCODE(0x04)	B_ = inc8(B_); OPNEXT(0x04, 1)
+		OPCODE(0x05)	B_ = dec8(B_); OPNEXT(0x05, 1)
+		OPCODE(0x06)	B_ = OPB(1); OPNEXT(0x06, 2)
+		OPCODE(0x0a)	A_ = memRd(BC_); OPNEXT(0x0a, 1)
+		OPCODE(0x0b)	BC_--; OPNEXT(0x0b, 1)
+		OPCODE(0x0c)	C_ = inc8(C_); OPNEXT(0x0c, 1)
+		OPCODE(0x0d)	C_ = dec8(C_); OPNEXT(0x0d, 1)
+		OPCODE(0x0e)	C_ = OPB(1); OPNEXT(0x0e, 2)
+		OPCODE(0x10)	e = (int8_t)OPB(1); PC_ += 2; B_--; if (B_ != 0) PC_ += e; OPBRANCH(0x10, B_ != 0)
+		OPCODE(0x11)	DE_ = OPW(1); OPNEXT(0x11, 3)
+		OPCODE(0x12)	memWr(DE_, A_); OPNEXT(0x12, 1)
+		OPCODE(0x13)	DE_++; OPNEXT(0x13, 1)
+		OPCODE(0x14)	D_ = inc8(D_); OPNEXT(0x14, 1)
+		OPCODE(0x15)	D_ = dec8(D_); OPNEXT(0x15, 1)
+		OPCODE(0x16)	D_ = OPB(1); OPNEXT(0x16, 2)
+		OPCODE(0x18)	PC_ += 2; jumpTo(PC_ + (int8_t)OPB(1)); OPBRANCH(0x18, true)
+		OPCODE(0x1a)	A_ = memRd(DE_); OPNEXT(0x1a, 1)
+		OPCODE(0x1b)	DE_--; OPNEXT(0x1b, 1)
+		OPCODE(0x1c)	E_ = inc8(E_); OPNEXT(0x1c, 1)
+		OPCODE(0x1d)	E_ = dec8(E_); OPNEXT(0x1d, 1)
+		OPCODE(0x1e)	E_ = OPB(1); OPNEXT(0x1e, 2)
+		OPCODE(0x20)	PC_ += 2; if (!ZF) jumpTo(PC_ + (int8_t)OPB(1)); OPBRANCH(0x20, !ZF)
+		OPCODE(0x21)	HL_ = OPW(1); OPNEXT(0x21, 3)
+		OPCODE(0x22)	memWr16(OPW(1), HL_); OPNEXT(0x22, 3)
+		OPCODE(0x23)	HL_++; OPNEXT(0x23, 1)
+		OPCODE(0x24)	H_ = inc8(H_); OPNEXT(0x24, 1)
+		OPCODE(0x25)	H_ = dec8(H_); OPNEXT(0x25, 1)
+		OPCODE(0x26)	H_ = OPB(1); OPNEXT(0x26, 2)
+		OPCODE(0x28)	PC_ += 2; if (ZF) jumpTo(PC_ + (int8_t)OPB(1)); OPBRANCH(0x28, ZF)
+		OPCODE(0x2a)	HL_ = memRd16(OPW(1)); OPNEXT(0x2a, 3)
+		OPCODE(0x2b)	HL_--; OPNEXT(0x2b, 1)
+		OPCODE(0x2c)	L_ = inc8(L_); OPNEXT(0x2c, 1)
+		OPCODE(0x2d)	L_ = dec8(L_); OPNEXT(0x2d, 1)
+		OPCODE(0x2e)	L_ = OPB(1); OPNEXT(0x2e, 2)
+		OPCODE(0x30)	PC_ += 2; if (!CF) jumpTo(PC_ + (int8_t)OPB(1)); OPBRANCH(0x30, !CF)
+		OPCODE(0x31)	SP_ = OPW(1); OPNEXT(0x31, 3)
+		OPCODE(0x32)	memWr(OPW(1), A_); OPNEXT(0x32, 3)
+		OPCODE(0x33)	SP_++; OPNEXT(0x33, 1)
+		OPCODE(0x34)	memWr(HL_, inc8(memRd(HL_))); OPNEXT(0x34, 1)
+		OPCODE(0x35)	memWr(HL_, dec8(memRd(HL_))); OPNEXT(0x35, 1)
+		OPCODE(0x36)	memWr(HL_, OPB(1)); OPNEXT(0x36, 2)
+		OPCODE(0x38)	PC_ += 2; if (CF) jumpTo(PC_ + (int8_t)OPB(1)); OPBRANCH(0x38, CF)
+		OPCODE(0x3a)	A_ = memRd(OPW(1)); OPNEXT(0x3a, 3)
+		OPCODE(0x3b)	SP_--; OPNEXT(0x3b, 1)
+		OPCODE(0x3c)	A_ = inc8(A_); OPNEXT(0x3c, 1)
+		OPCODE(0x3d)	A_ = dec8(A_); OPNEXT(0x3d, 1)
+		OPCODE(0x3e)	A_ = OPB(1); OPNEXT(0x3e, 2)
+		OPCODE(0x40)	OPNEXT(0x40, 1)
+		OPCODE(0x41)	B_ = C_; OPNEXT(0x41, 1)
+		OPCODE(0x42)	B_ = D_; OPNEXT(0x42, 1)
+		OPCODE(0x43)	B_ = E_; OPNEXT(0x43, 1)
+		OPCODE(0x44)	B_ = H_; OPNEXT(0x44, 1)
+		OPCODE(0x45)	B_ = L_; OPNEXT(0x45, 1)
+		OPCODE(0x46)	B_ = memRd(HL_); OPNEXT(0x46, 1)
+		OPCODE(0x47)	B_ = A_; OPNEXT(0x47, 1)
+		OPCODE(0x48)	C_ = B_; OPNEXT(0x48, 1)
+		OPCODE(0x49)	OPNEXT(0x49, 1)
+		OPCODE(0x4a)	C_ = D_; OPNEXT(0x4a, 1)
+		OPCODE(0x4b)	C_ = E_; OPNEXT(0x4b, 1)
+		OPCODE(0x4c)	C_ = H_; OPNEXT(0x4c, 1)
+		OPCODE(0x4d)	C_ = L_; OPNEXT(0x4d, 1)
+		OPCODE(0x4e)	C_ = memRd(HL_); OPNEXT(0x4e, 1)
+		OPCODE(0x4f)	C_ = A_; OPNEXT(0x4f, 1)
+		OPCODE(0x50)	D_ = B_; OPNEXT(0x50, 1)
+		OPCODE(0x51)	D_ = C_; OPNEXT(0x51, 1)
+		OPCODE(0x52)	OPNEXT(0x52, 1)
+		OPCODE(0x53)	D_ = E_; OPNEXT(0x53, 1)
+		OPCODE(0x54)	D_ = H_; OPNEXT(0x54, 1)
+		OPCODE(0x55)	D_ = L_; OPNEXT(0x55, 1)
+		OPCODE(0x56)	D_ = memRd(HL_); OPNEXT(0x56, 1)
+		OPCODE(0x57)	D_ = A_; OPNEXT(0x57, 1)
+		OPCODE(0x58)	E_ = B_; OPNEXT(0x58, 1)
+		OPCODE(0x59)	E_ = C_; OPNEXT(0x59, 1)
+		OPCODE(0x5a)	E_ = D_; OPNEXT(0x5a, 1)
+		OPCODE(0x5b)	OPNEXT(0x5b, 1)
+		OPCODE(0x5c)	E_ = H_; OPNEXT(0x5c, 1)
+		OPCODE(0x5d)	E_ = L_; OPNEXT(0x5d, 1)
+		OPCODE(0x5e)	E_ = memRd(HL_); OPNEXT(0x5e, 1)
+		OPCODE(0x5f)	E_ = A_; OPNEXT(0x5f, 1)
+		OPCODE(0x60)	H_ = B_; OPNEXT(0x60, 1)
+		OPCODE(0x61)	H_ = C_; OPNEXT(0x61, 1)
+		OPCODE(0x62)	H_ = D_; OPNEXT(0x62, 1)
+		OPCODE(0x63)	H_ = E_; OPNEXT(0x63, 1)
+		OPCODE(0x64)	OPNEXT(0x64, 1)
+		OPCODE(0x65)	H_ = L_; OPNEXT(0x65, 1)
+		OPCODE(0x66)	H_ = memRd(HL_); OPNEXT(0x66, 1)
+		OPCODE(0x67)	H_ = A_; OPNEXT(0x67, 1)
+		OPCODE(0x68)	L_ = B_; OPNEXT(0x68, 1)
+		OPCODE(0x69)	L_ = C_; OPNEXT(0x69, 1)
+		OPCODE(0x6a)	L_ = D_; OPNEXT(0x6a, 1)
+		OPCODE(0x6b)	L_ = E_; OPNEXT(0x6b, 1)
+		OPCODE(0x6c)	L_ = H_; OPNEXT(0x6c, 1)
+		OPCODE(0x6d)	OPNEXT(0x6d, 1)
+		OPCODE(0x6e)	L_ = memRd(HL_); OPNEXT(0x6e, 1)
+		OPCODE(0x6f)	L_ = A_; OPNEXT(0x6f, 1)
+		OPCODE(0x70)	memWr(HL_, B_); OPNEXT(0x70, 1)
+		OPCODE(0x71)	memWr(HL_, C_); OPNEXT(0x71, 1)
+		OPCODE(0x72)	memWr(HL_, D_); OPNEXT(0x72, 1)
+		OPCODE(0x73)	memWr(HL_, E_); OPNEXT(0x73, 1)
+		OPCODE(0x74)	memWr(HL_, H_); OPNEXT(0x74, 1)
+		OPCODE(0x75)	memWr(HL_, L_); OPNEXT(0x75, 1)
+		OPCODE(0x77)	memWr(HL_, A_); OPNEXT(0x77, 1)
+		OPCODE(0x78)	A_ = B_; OPNEXT(0x78, 1)
+		OPCODE(0x79)	A_ = C_; OPNEXT(0x79, 1)
+		OPCODE(0x7a)	A_ = D_; OPNEXT(0x7a, 1)
+		OPCODE(0x7b)	A_ = E_; OPNEXT(0x7b, 1)
+		OPCODE(0x7c)	A_ = H_; OPNEXT(0x7c, 1)
+		OPCODE(0x7d)	A_ = L_; OPNEXT(0x7d, 1)
+		OPCODE(0x7e)	A_ = memRd(HL_); OPNEXT(0x7e, 1)
+		OPCODE(0x7f)	OPNEXT(0x7f, 1)
+		OPCODE(0x80)	add8(B_); OPNEXT(0x80, 1)
+		OPCODE(0x81)	add8(C_); OPNEXT(0x81, 1)
+		OPCODE(0x82)	add8(D_); OPNEXT(0x82, 1)
+		OPCODE(0x83)	add8(E_); OPNEXT(0x83, 1)
+		OPCODE(0x84)	add8(H_); OPNEXT(0x84, 1)
+		OPCODE(0x85)	add8(L_); OPNEXT(0x85, 1)
+		OPCODE(0x86)	add8(memRd(HL_)); OPNEXT(0x86, 1)
+		OPCODE(0x87)	add8(A_); OPNEXT(0x87, 1)
+		OPCODE(0x88)	adc8(B_); OPNEXT(0x88, 1)
+		OPCODE(0x89)	adc8(C_); OPNEXT(0x89, 1)
+		OPCODE(0x8a)	adc8(D_); OPNEXT(0x8a, 1)
+		OPCODE(0x8b)	adc8(E_); OPNEXT(0x8b, 1)
+		OPCODE(0x8c)	adc8(H_); OPNEXT(0x8c, 1)
+		OPCODE(0x8d)	adc8(L_); OPNEXT(0x8d, 1)
+		OPCODE(0x8e)	adc8(memRd(HL_)); OPNEXT(0x8e, 1)
+		OPCODE(0x8f)	adc8(A_); OPNEXT(0x8f, 1)
+		OPCODE(0x90)	sub8(B_); OPNEXT(0x90, 1)
+		OPCODE(0x91)	sub8(C_); OPNEXT(0x91, 1)
+		OPCODE(0x92)	sub8(D_); OPNEXT(0x92, 1)
+		OPCODE(0x93)	sub8(E_); OPNEXT(0x93, 1)
+		OPCODE(0x94)	sub8(H_); OPNEXT(0x94, 1)
+		OPCODE(0x95)	sub8(L_); OPNEXT(0x95, 1)
+		OPCODE(0x96)	sub8(memRd(HL_)); OPNEXT(0x96, 1)
+		OPCODE(0x97)	sub8(A_); OPNEXT(0x97, 1)
+		OPCODE(0x98)	sbc8(B_); OPNEXT(0x98, 1)
+		OPCODE(0x99)	sbc8(C_); OPNEXT(0x99, 1)
+		OPCODE(0x9a)	sbc8(D_); OPNEXT(0x9a, 1)
+		OPCODE(0x9b)	sbc8(E_); OPNEXT(0x9b, 1)
+		OPCODE(0x9c)	sbc8(H_); OPNEXT(0x9c, 1)
+		OPCODE(0x9d)	sbc8(L_); OPNEXT(0x9d, 1)
+		OPCODE(0x9e)	sbc8(memRd(HL_)); OPNEXT(0x9e, 1)
+		OPCODE(0x9f)	sbc8(A_); OPNEXT(0x9f, 1)
+		OPCODE(0xa0)	and8(B_); OPNEXT(0xa0, 1)
+		OPCODE(0xa1)	and8(C_); OPNEXT(0xa1, 1)
+		OPCODE(0xa2)	and8(D_); OPNEXT(0xa2, 1)
+		OPCODE(0xa3)	and8(E_); OPNEXT(0xa3, 1)
+		OPCODE(0xa4)	and8(H_); OPNEXT(0xa4, 1)
+		OPCODE(0xa5)	and8(L_); OPNEXT(0xa5, 1)
+		OPCODE(0xa6)	and8(memRd(HL_)); OPNEXT(0xa6, 1)
+		OPCODE(0xa7)	and8(A_); OPNEXT(0xa7, 1)
+		OPCODE(0xa8)	xor8(B_); OPNEXT(0xa8, 1)
+		OPCODE(0xa9)	xor8(C_); OPNEXT(0xa9, 1)
+		OPCODE(0xaa)	xor8(D_); OPNEXT(0xaa, 1)
+		OPCODE(0xab)	xor8(E_); OPNEXT(0xab, 1)
+		OPCODE(0xac)	xor8(H_); OPNEXT(0xac, 1)
+		OPCODE(0xad)	xor8(L_); OPNEXT(0xad, 1)
+		OPCODE(0xae)	xor8(memRd(HL_)); OPNEXT(0xae, 1)
+		OPCODE(0xaf)	xor8(A_); OPNEXT(0xaf, 1)
+		OPCODE(0xb0)	or8(B_); OPNEXT(0xb0, 1)
+		OPCODE(0xb1)	or8(C_); OPNEXT(0xb1, 1)
+		OPCODE(0xb2)	or8(D_); OPNEXT(0xb2, 1)
+		OPCODE(0xb3)	or8(E_); OPNEXT(0xb3, 1)
+		OPCODE(0xb4)	or8(H_); OPNEXT(0xb4, 1)
+		OPCODE(0xb5)	or8(L_); OPNEXT(0xb5, 1)
+		OPCODE(0xb6)	or8(memRd(HL_)); OPNEXT(0xb6, 1)
+		OPCODE(0xb7)	or8(A_); OPNEXT(0xb7, 1)
+		OPCODE(0xb8)	cp8(B_); OPNEXT(0xb8, 1)
+		OPCODE(0xb9)	cp8(C_); OPNEXT(0xb9, 1)
+		OPCODE(0xba)	cp8(D_); OPNEXT(0xba, 1)
+		OPCODE(0xbb)	cp8(E_); OPNEXT(0xbb, 1)
+		OPCODE(0xbc)	cp8(H_); OPNEXT(0xbc, 1)
+		OPCODE(0xbd)	cp8(L_); OPNEXT(0xbd, 1)
+		OPCODE(0xbe)	cp8(memRd(HL_)); OPNEXT(0xbe, 1)
+		OPCODE(0xbf)	cp8(A_); OPNEXT(0xbf, 1)
+		OPCODE(0xc1)	BC_ = stkRd16(SP_); OPNEXT(0xc1, 1)
+		OPCODE(0xc2)	PC_ += 3; if (!ZF) jumpTo(OPW(1)); OPBRANCH(0xc2, true)
+		OPCODE(0xc3)	PC_ += 3; jumpTo(OPW(1)); OPBRANCH(0xc3, true)
+		OPCODE(0xc5)	stkWr16(SP_, BC_); OPNEXT(0xc5, 1)
+		OPCODE(0xc6)	add8(OPB(1)); OPNEXT(0xc6, 2)
+		OPCODE(0xc7)	PC_ += 1; stkWr16(SP_, PC_); PC_ = 0x00; OPBRANCH(0xc7, true)
+		OPCODE(0xc9)	PC_ = stkRd16(SP_); OPBRANCH(0xc9, true)
+		OPCODE(0xca)	PC_ += 3; if (ZF) jumpTo(OPW(1)); OPBRANCH(0xca, true)
+		OPCODE(0xcd)	u16 = OPW(1); PC_ += 3; SP_ -= 2; memWr16(SP_, PC_); PC_ = u16; OPBRANCH(0xcd, true)
+		OPCODE(0xce)	adc8(OPB(1)); OPNEXT(0xce, 2)
+		OPCODE(0xcf)	PC_ += 1; stkWr16(SP_, PC_); PC_ = 0x08; OPBRANCH(0xcf, true)
+		OPCODE(0xd1)	DE_ = stkRd16(SP_); OPNEXT(0xd1, 1)
+		OPCODE(0xd2)	PC_ += 3; if (!CF) jumpTo(OPW(1)); OPBRANCH(0xd2, true)
+		OPCODE(0xd3)	ioWr(OPB(1), A_); OPNEXT(0xd3, 2)
+		OPCODE(0xd5)	stkWr16(SP_, DE_); OPNEXT(0xd5, 1)
+		OPCODE(0xd6)	sub8(OPB(1)); OPNEXT(0xd6, 2)
+		OPCODE(0xd7)	PC_ += 1; stkWr16(SP_, PC_); PC_ = 0x10; OPBRANCH(0xd7, true)
+		OPCODE(0xda)	PC_ += 3; if (CF) jumpTo(OPW(1)); OPBRANCH(0xda, true)
+		OPCODE(0xdb)	A_ = ioRd(OPB(1)); OPNEXT(0xdb, 2)
+		OPCODE(0xde)	sbc8(OPB(1)); OPNEXT(0xde, 2)
+		OPCODE(0xdf)	PC_ += 1; stkWr16(SP_, PC_); PC_ = 0x18; OPBRANCH(0xdf, true)
+		OPCODE(0xe1)	HL_ = stkRd16(SP_); OPNEXT(0xe1, 1)
+		OPCODE(0xe2)	PC_ += 3; if (!PF) jumpTo(OPW(1)); OPBRANCH(0xe2, true)
+		OPCODE(0xe5)	stkWr16(SP_, HL_); OPNEXT(0xe5, 1)
+		OPCODE(0xe6)	and8(OPB(1)); OPNEXT(0xe6, 2)
+		OPCODE(0xe7)	PC_ += 1; stkWr16(SP_, PC_); PC_ = 0x20; OPBRANCH(0xe7, true)
+		OPCODE(0xea)	PC_ += 3; if (PF) jumpTo(OPW(1)); OPBRANCH(0xea, true)
+		OPCODE(0xeb)	WZ_ = HL_; HL_ = DE_; DE_ = WZ_; OPNEXT(0xeb, 1)
+		OPCODE(0xee)	xor8(OPB(1)); OPNEXT(0xee, 2)
+		OPCODE(0xef)	PC_ += 1; stkWr16(SP_, PC_); PC_ = 0x28; OPBRANCH(0xef, true)
+		OPCODE(0xf1)	AF_ = stkRd16(SP_); OPNEXT(0xf1, 1)
+		OPCODE(0xf2)	PC_ += 3; if (!SF) jumpTo(OPW(1)); OPBRANCH(0xf2, true)
+		OPCODE(0xf3)	bIFF1 = false; bIFF2 = false; OPNEXT(0xf3, 1)
+		OPCODE(0xf5)	stkWr16(SP_, AF_); OPNEXT(0xf5, 1)
+		OPCODE(0xf6)	or8(OPB(1)); OPNEXT(0xf6, 2)
+		OPCODE(0xf7)	PC_ += 1; stkWr16(SP_, PC_); PC_ = 0x30; OPBRANCH(0xf7, true)
+		OPCODE(0xfa)	PC_ += 3; if (SF) jumpTo(OPW(1)); OPBRANCH(0xfa, true)
+		OPCODE(0xfb)	bIFF1 = true; bIFF2 = true; OPNEXT(0xfb, 1)
+		OPCODE(0xfe)	cp8(OPB(1)); OPNEXT(0xfe, 2)
+		OPCODE(0xff)	PC_ += 1; stkWr16(SP_, PC_); PC_ = 0x38; OPBRANCH(0xff, true)
+
+		OPGENERIC
+			decode();
+			execute();
+			goto opexecuted;
+		}
+
+	opcomplete:
+		//Increment R Register, bit 7 is not changed by the operation
+		R_ = (R_ & 0x80) | ((R_ + 1) & 0x7f);
+		nInstrCounter++;
+
+	opexecuted:
+		nCycleCounter += cycles;
+
+		//DEBUG ONLY
 		bOpcodeComplete = true;
-	   	  
-	return true;
+	}
+}
+
+#undef DISPATCH
+#undef OPCODE
+#undef OPGENERIC
+#undef OPNEXT
+#undef OPBRANCH
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+//                                 Idle Loop, HALT & Block Transfer Fast-Forward
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//Games spend a good part of each frame polling RAM, the V Counter or the VDP Status waiting for
+//an Interrupt. A loop iteration that writes nothing, reads only Ports that can be polled and gets
+//back to the loop head with the same Registers does exactly the same thing on the next iteration,
+//until an Interrupt (raised only when run() ends) or a change on the polled Ports. All the
+//iterations before that are skipped at once, advancing the Cycle Counter, the Instruction Counter
+//and R as if they were executed. VDP and PSG catch up from the Cycle Counter as usual.
+
+//Jump to addr, PC must already point to the next Instruction
+inline void Z80A::jumpTo(uint16_t addr)
+{
+	bool bBackwards = (addr < PC_);
+
+	PC_ = addr;
+
+	if (bBackwards)
+		idleLoop();
+}
+
+Z80A::IDLESTATE Z80A::getIdleState()
+{
+	return { AF_, BC_, DE_, HL_, af1.w, bc1.w, de1.w, hl1.w, IX_, IY_, SP_, WZ_,
+			 (uint16_t)((I_ << 8) | intmode), (uint16_t)((bIFF1 << 1) | bIFF2) };
+}
+
+//Called on every Jump taken backwards, PC is the loop head. Cycle Counter, Instruction Counter
+//and R don't include the Jump yet, the same way on every iteration
+void Z80A::idleLoop()
+{
+	IDLESTATE state = getIdleState();
+
+	if ((PC_ == nIdlePC) && !bIdleDirty && (state == idleState) && (nCycleCounter > nIdleCycle))
+	{
+		uint64_t nPeriod = nCycleCounter - nIdleCycle;
+
+		//Last Cycle an iteration can start at, before the end of run() and before the polled Ports change
+		uint64_t nLimit = (nRunEnd != 0) ? nRunEnd - 1 : 0;
+		if (bIdleVdp)
+		{
+			//Differential Mode, the shadow CPU gets the limit the cached Instruction got
+			uint64_t nVdpLimit;
+			if ((pDiff != nullptr) && pDiff->bReplay)
+			{
+				nVdpLimit = pDiff->nextQuery();
+			}
+			else
+			{
+				nVdpLimit = sms->GetIdleCycleLimit(nIdleGeneration, bIdleStatus);
+				if (pDiff != nullptr)
+					pDiff->query.push_back(nVdpLimit);
+			}
+
+			nLimit = std::min(nLimit, nVdpLimit);
+		}
+
+		if (nLimit > nCycleCounter)
+		{
+			uint64_t nSkip = (nLimit - nCycleCounter) / nPeriod;
+			fastForward(nSkip * nPeriod, nSkip * (nInstrCounter - nIdleInstr), nSkip * ((R_ - nIdleR) & 0x7f));
+		}
+	}
+
+	//Probe the next iteration
+	idleState = state;
+	nIdlePC = PC_;
+	nIdleCycle = nCycleCounter;
+	nIdleInstr = nInstrCounter;
+	nIdleR = R_;
+	bIdleDirty = false;
+	bIdleVdp = false;
+	bIdleStatus = false;
+}
+
+//Advance the CPU as if nInstr Instructions taking nCycles clock cycles and incrementing R
+//nRefresh times were executed
+void Z80A::fastForward(uint64_t nCycles, uint64_t nInstr, uint64_t nRefresh)
+{
+	nCycleCounter += nCycles;
+	nInstrCounter += nInstr;
+	R_ = (R_ & 0x80) | ((R_ + nRefresh) & 0x7f);
+}
+
+//Repeated Block Instructions (LDIR, OTIR...) run their following iterations in bulk right in
+//the first one, as long as they start before the end of run(). Each iteration is accounted with
+//fastForward() before its transfer, so I/O accesses keep their own timestamp.
+
+//Number of iterations that can follow the current one before the end of run()
+uint64_t Z80A::blockIterations()
+{
+	uint64_t nPeriod = instSet[indexOp].cycles1;
+	uint64_t nIter = 0;
+
+	//Differential Mode, the end of run() and the Interrupt latches can change on an I/O access of
+	//the cached Instruction, the shadow CPU gets the iterations it got
+	if ((pDiff != nullptr) && pDiff->bReplay)
+		return pDiff->nextQuery();
+
+	if ((nRunEnd != 0) && !nmi_latch && !irq_latch && (nRunEnd - 1 >= nCycleCounter))
+		nIter = (nRunEnd - 1 - nCycleCounter) / nPeriod;
+
+	if (pDiff != nullptr)
+		pDiff->query.push_back(nIter);
+
+	return nIter;
+}
+
+//Copy up to nMax bytes from HL to DE (stepping up or down by nStep) straight between Memory
+//Pages, without crossing a page boundary. Returns the number of bytes copied, 0 when the pages go
+//thru the slow path or when source and destination overlap (LDIR fill idiom), in that case the
+//transfer goes on a byte at a time
+uint16_t Z80A::blockCopy(uint32_t nMax, int nStep)
+{
+	const uint8_t* src = sms->GetReadPtr(HL_);
+	uint8_t* dst = sms->GetWritePtr(DE_);
+
+	if ((src == nullptr) || (dst == nullptr))
+		return 0;
+
+	//Bytes left in the source and destination pages
+	uint32_t n = std::min(nMax, (nStep > 0) ? 0x400u - (HL_ & 0x03ff) : (HL_ & 0x03ffu) + 1);
+	n = std::min(n, (nStep > 0) ? 0x400u - (DE_ & 0x03ff) : (DE_ & 0x03ffu) + 1);
+
+	//Lowest address of both ranges
+	uint16_t srclo = (nStep > 0) ? HL_ : HL_ - n + 1;
+	uint16_t dstlo = (nStep > 0) ? DE_ : DE_ - n + 1;
+
+	//Ranges must not overlap, the Instruction itself must not be overwritten
+	if ((srclo < dstlo + n) && (dstlo < srclo + n))
+		return 0;
+	if ((uint16_t)(PC_ - 2 - dstlo) < n || (uint16_t)(PC_ - 1 - dstlo) < n)
+		return 0;
+
+	//Differential Mode, the transfer goes thru the Bus journal a byte at a time
+	if (pDiff != nullptr)
+	{
+		for (uint32_t i = 0; i < n; i++)
+			memWr(dstlo + i, memRd(srclo + i));
+	}
+	else
+		std::memcpy(dst - (DE_ - dstlo), src - (HL_ - srclo), n);
+
+	bIdleDirty = true;
+	HL_ += nStep * (int)n;
+	DE_ += nStep * (int)n;
+
+	return (uint16_t)n;
 }
 
 bool Z80A::reset()
@@ -1943,7 +4619,12 @@ bool Z80A::reset()
 	nmi_latch = false;
 	irq_latch = false;
 
+	ticks = 0;
 	nCycleCounter = 0;
+	nInstrCounter = 0;
+
+	nRunEnd = 0;
+	bIdleDirty = true;
 
 	return true;
 }
@@ -1966,18 +4647,52 @@ bool Z80A::nmi()
 
 uint8_t Z80A::memRd(uint16_t addr)
 {
+	//Differential Mode, the shadow CPU reads its own writes over the Memory before the Instruction
+	if ((pDiff != nullptr) && pDiff->bReplay)
+	{
+		uint8_t flags = pDiff->memFlags[addr];
+		if (flags & DIFFBUS::MEMNEW)
+			return pDiff->memNew[addr];
+		if (flags & DIFFBUS::MEMOLD)
+			return pDiff->memOld[addr];
+	}
+
 	return sms->readMem(addr);
 }
 
 uint16_t Z80A::memRd16(uint16_t addr)
 {
-	uint16_t uResult = sms->readMem(addr) + (sms->readMem(addr + 1) << 8);
+	uint16_t uResult = memRd(addr) + (memRd(addr + 1) << 8);
 
 	return uResult;
 }
 
 bool Z80A::memWr(uint16_t addr, uint8_t data)
 {
+	bIdleDirty = true;
+
+	//Differential Mode, record the Memory content before the first write, the shadow CPU
+	//writes to the journal only
+	if (pDiff != nullptr)
+	{
+		uint8_t& flags = pDiff->memFlags[addr];
+		if (flags == 0)
+			pDiff->memTouched.push_back(addr);
+
+		if (pDiff->bReplay)
+		{
+			pDiff->memNew[addr] = data;
+			flags |= DIFFBUS::MEMNEW;
+			return true;
+		}
+
+		if (!(flags & DIFFBUS::MEMOLD))
+		{
+			pDiff->memOld[addr] = sms->readMem(addr);
+			flags |= DIFFBUS::MEMOLD;
+		}
+	}
+
 	sms->writeMem(addr, data);
 
 	return true;
@@ -1985,15 +4700,15 @@ bool Z80A::memWr(uint16_t addr, uint8_t data)
 
 bool Z80A::memWr16(uint16_t addr, uint16_t data)
 {
-	sms->writeMem(addr, (uint8_t)data);
-	sms->writeMem(addr + 1, (uint8_t)(data >> 8));
+	memWr(addr, (uint8_t)data);
+	memWr(addr + 1, (uint8_t)(data >> 8));
 
 	return true;
 }
 
 uint16_t Z80A::stkRd16(uint16_t addr)
 {
-	uint16_t uResult = sms->readMem(addr) + (sms->readMem(addr + 1) << 8);
+	uint16_t uResult = memRd(addr) + (memRd(addr + 1) << 8);
 
 	SP_ += 2;
 
@@ -2002,8 +4717,8 @@ uint16_t Z80A::stkRd16(uint16_t addr)
 
 bool Z80A::stkWr16(uint16_t addr, uint16_t data)
 {
-	sms->writeMem(addr - 2, (uint8_t)data);
-	sms->writeMem(addr - 1 , (uint8_t)(data >> 8));
+	memWr(addr - 2, (uint8_t)data);
+	memWr(addr - 1 , (uint8_t)(data >> 8));
 
 	SP_ -= 2;
 
@@ -2012,12 +4727,46 @@ bool Z80A::stkWr16(uint16_t addr, uint16_t data)
 
 uint8_t Z80A::ioRd(uint8_t addr)
 {
-	return sms->readIO(addr);
+	//Track the Ports polled by a loop for the Idle Loop Detection
+	switch (sms->GetIdlePort(addr))
+	{
+	case SMS::IDLE_UNSAFE:
+		bIdleDirty = true;
+		break;
+	case SMS::IDLE_STABLE:
+		break;
+	case SMS::IDLE_STATUS:
+		bIdleStatus = true;
+		[[fallthrough]];
+	case SMS::IDLE_VCOUNTER:
+		if (!bIdleVdp)
+		{
+			bIdleVdp = true;
+			nIdleGeneration = sms->GetIdleGeneration();
+		}
+		break;
+	}
+
+	if (pDiff == nullptr)
+		return sms->readIO(addr);
+
+	//Differential Mode, the shadow CPU gets the values the cached Instruction read
+	if (pDiff->bReplay)
+		return pDiff->nextIoRead();
+
+	uint8_t data = sms->readIO(addr);
+	pDiff->ioRead.push_back(data);
+
+	return data;
 }
 
 bool Z80A::ioWr(uint8_t addr, uint8_t data)
 {
-	sms->writeIO(addr, data);
+	bIdleDirty = true;
+
+	//Differential Mode, the shadow CPU has no side effects
+	if ((pDiff == nullptr) || !pDiff->bReplay)
+		sms->writeIO(addr, data);
 
 	return true;
 }
@@ -2028,18 +4777,6 @@ bool Z80A::ioWr(uint8_t addr, uint8_t data)
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-//Evaluate Parity
-inline bool Z80A::isP(uint8_t a)
-{
-	//Check Parity on one Byte in Even
-
-	//return 0 for even number of 1's
-	//return 1 for odd number of 1's
-	a ^= a >> 4;
-	a &= 0xf;
-	return !((0x6996 >> a) & 1);
-}
-
 //Evaluate Carry
 inline bool Z80A::isC(uint32_t res, uint32_t b, uint8_t c, uint8_t bit)
 {
@@ -2074,6 +4811,78 @@ inline bool Z80A::isU(uint32_t res, uint32_t b, uint8_t c, uint8_t bit)
 	return uResult;
 }
 
+//8-Bit Arithmetic and Logic on the Accumulator, shared by the generic Instruction
+//Handlers and by the specialized Handlers of the Threaded Interpreter. Sign, Zero and
+//Parity come from the Flag tables, Half Carry, Overflow and Carry from the 9-bit result
+inline void Z80A::add8(uint8_t v)
+{
+	uint16_t r = A_ + v;
+	F_ = (F_ & (XM | YM)) | flagTable.SZ[r & 0xff] | ((A_ ^ v ^ r) & HM) | (((A_ ^ ~v) & (A_ ^ r) & 0x80) >> 5) | (r >> 8);
+	A_ = (uint8_t)r;
+}
+
+inline void Z80A::adc8(uint8_t v)
+{
+	uint16_t r = A_ + v + CF;
+	F_ = (F_ & (XM | YM)) | flagTable.SZ[r & 0xff] | ((A_ ^ v ^ r) & HM) | (((A_ ^ ~v) & (A_ ^ r) & 0x80) >> 5) | (r >> 8);
+	A_ = (uint8_t)r;
+}
+
+inline void Z80A::sub8(uint8_t v)
+{
+	uint16_t r = A_ - v;
+	F_ = (F_ & (XM | YM)) | flagTable.SZ[r & 0xff] | ((A_ ^ v ^ r) & HM) | (((A_ ^ v) & (A_ ^ r) & 0x80) >> 5) | NM | ((r >> 8) & CM);
+	A_ = (uint8_t)r;
+}
+
+inline void Z80A::sbc8(uint8_t v)
+{
+	uint16_t r = A_ - v - CF;
+	F_ = (F_ & (XM | YM)) | flagTable.SZ[r & 0xff] | ((A_ ^ v ^ r) & HM) | (((A_ ^ v) & (A_ ^ r) & 0x80) >> 5) | NM | ((r >> 8) & CM);
+	A_ = (uint8_t)r;
+}
+
+inline void Z80A::and8(uint8_t v)
+{
+	A_ &= v;
+	F_ = (F_ & (XM | YM)) | flagTable.SZP[A_] | HM;
+}
+
+inline void Z80A::or8(uint8_t v)
+{
+	A_ |= v;
+	F_ = (F_ & (XM | YM)) | flagTable.SZP[A_];
+}
+
+inline void Z80A::xor8(uint8_t v)
+{
+	A_ ^= v;
+	F_ = (F_ & (XM | YM)) | flagTable.SZP[A_];
+}
+
+inline void Z80A::cp8(uint8_t v)
+{
+	uint16_t r = A_ - v;
+	F_ = (F_ & (XM | YM)) | flagTable.SZ[r & 0xff] | ((A_ ^ v ^ r) & HM) | (((A_ ^ v) & (A_ ^ r) & 0x80) >> 5) | NM | ((r >> 8) & CM);
+}
+
+//8-Bit Increment and Decrement, return the new value. Carry is not affected
+inline uint8_t Z80A::inc8(uint8_t v)
+{
+	v++;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZHV_inc[v];
+
+	return v;
+}
+
+inline uint8_t Z80A::dec8(uint8_t v)
+{
+	v--;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZHV_dec[v];
+
+	return v;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //
@@ -2563,6 +5372,32 @@ bool Z80A::LDIR()
 {
 	LDI();
 
+	//Following iterations in bulk, whole runs of bytes are copied between Memory Pages
+	uint64_t nIter = std::min<uint64_t>(blockIterations(), BC_);
+	while (nIter > 0)
+	{
+		uint16_t n = blockCopy((uint32_t)nIter, 1);
+
+		if (n != 0)
+		{
+			fastForward((uint64_t)n * instSet[indexOp].cycles1, n, 2 * n);
+			BC_ -= n;
+			HF = 0; PF = (BC_ != 0); NF = 0;
+		}
+		else
+		{
+			//Stop before overwriting the Instruction itself
+			if ((uint16_t)(DE_ - (PC_ - 2)) < 2)
+				break;
+
+			fastForward(instSet[indexOp].cycles1, 1, 2);
+			LDI();
+			n = 1;
+		}
+
+		nIter -= n;
+	}
+
 	if (BC_ != 0)
 	{
 		//Repeat OPCode until BC = 0
@@ -2593,6 +5428,32 @@ bool Z80A::LDDR()
 {
 	LDD();
 
+	//Following iterations in bulk, whole runs of bytes are copied between Memory Pages
+	uint64_t nIter = std::min<uint64_t>(blockIterations(), BC_);
+	while (nIter > 0)
+	{
+		uint16_t n = blockCopy((uint32_t)nIter, -1);
+
+		if (n != 0)
+		{
+			fastForward((uint64_t)n * instSet[indexOp].cycles1, n, 2 * n);
+			BC_ -= n;
+			HF = 0; PF = (BC_ != 0); NF = 0;
+		}
+		else
+		{
+			//Stop before overwriting the Instruction itself
+			if ((uint16_t)(DE_ - (PC_ - 2)) < 2)
+				break;
+
+			fastForward(instSet[indexOp].cycles1, 1, 2);
+			LDD();
+			n = 1;
+		}
+
+		nIter -= n;
+	}
+
 	if (BC_ != 0)
 	{
 		//Repeat Opcode until BC = 0
@@ -2613,7 +5474,7 @@ bool Z80A::CPI()
 	HL_++; BC_--;
 			
 	//Update Flags
-	SF = (res >> 7); ZF = (res == 0); HF = isB(res, u8, 0, 4); PF = (BC_ != 0); NF = 1;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZ[res] | ((A_ ^ u8 ^ res) & HM) | ((BC_ != 0) ? PM : 0) | NM;
 			
 	return true;
 }
@@ -2643,7 +5504,7 @@ bool Z80A::CPD()
 	HL_--; BC_--;
 	
 	//Update Flags
-	SF = (res >> 7); ZF = (res == 0); HF = isB(res, u8, 0, 4); PF = (BC_ != 0); NF = 1;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZ[res] | ((A_ ^ u8 ^ res) & HM) | ((BC_ != 0) ? PM : 0) | NM;
 			
 	return true;
 }
@@ -2683,11 +5544,8 @@ bool Z80A::ADDR()
 	case 0b111: u8 = A_; break;
 	};
 
-	//Update Accumulator
-	A_ += u8;
-	
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = isC(A_, u8, 0, 4); PF = isO(A_, u8, 0, 8); NF = 0; CF = isC(A_, u8, 0, 8);
+	//Update Accumulator and Flags
+	add8(u8);
 		   	
 	return true;
 }
@@ -2695,12 +5553,8 @@ bool Z80A::ADDR()
 // ---- ADD A,n
 bool Z80A::ADDN()
 {
-	//Update Accumulator
-	u8 = OPB(1);
-	A_ += u8;
-
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = isC(A_, u8, 0, 4); PF = isO(A_, u8, 0, 8); NF = 0; CF = isC(A_, u8, 0, 8);
+	//Update Accumulator and Flags
+	add8(OPB(1));
 	
 	return true;
 }
@@ -2724,11 +5578,8 @@ bool Z80A::ADCR()
 	case 0b111: u8 = A_; break;
 	};
 
-	//Update Accumulator
-	A_ += (u8 + CF);
-
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = isC(A_, u8, CF, 4); PF = isO(A_, u8, CF, 8); NF = 0; CF = isC(A_, u8, CF, 8);
+	//Update Accumulator and Flags
+	adc8(u8);
 	
 	return true;
 }
@@ -2736,12 +5587,8 @@ bool Z80A::ADCR()
 // ---- ADC A,n
 bool Z80A::ADCN()
 {
-	//Update Accumulator
-	u8 = OPB(1);
-	A_ += (u8 + CF);
-
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = isC(A_, u8, CF, 4); PF = isO(A_, u8, CF, 8); NF = 0; CF = isC(A_, u8, CF, 8);
+	//Update Accumulator and Flags
+	adc8(OPB(1));
 	
 	return true;
 }
@@ -2765,11 +5612,8 @@ bool Z80A::SUBR()
 	case 0b111: u8 = A_; break;
 	};
 
-	//Update Accumulator
-	A_ -= u8;
-	
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = isB(A_, u8, 0, 4); PF = isU(A_, u8, 0, 8); NF = 1; CF = isB(A_, u8, 0, 8);
+	//Update Accumulator and Flags
+	sub8(u8);
 	
 	return true;
 }
@@ -2777,12 +5621,8 @@ bool Z80A::SUBR()
 // ---- SUB n
 bool Z80A::SUBN()
 {
-	//Update Accumulator
-	u8 = OPB(1);
-	A_ -= u8;
-
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = isB(A_, u8, 0, 4); PF = isU(A_, u8, 0, 8); NF = 1; CF = isB(A_, u8, 0, 8);
+	//Update Accumulator and Flags
+	sub8(OPB(1));
 
 	return true;
 }
@@ -2806,11 +5646,8 @@ bool Z80A::SBCR()
 	case 0b111: u8 = A_; break;
 	};
 	
-	//Update Accumulator
-	A_ -= (u8 + CF);
-
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = isB(A_, u8, CF, 4); PF = isU(A_, u8, CF, 8); NF = 1; CF = isB(A_, u8, CF, 8);
+	//Update Accumulator and Flags
+	sbc8(u8);
 	
 	return true;
 }
@@ -2818,12 +5655,8 @@ bool Z80A::SBCR()
 // ---- SBC A,n 
 bool Z80A::SBCN()
 {
-	//Update Accumulator
-	u8 = OPB(1);
-	A_ -= (u8 + CF);
-
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = isB(A_, u8, CF, 4); PF = isU(A_, u8, CF, 8); NF = 1; CF = isB(A_, u8, CF, 8);
+	//Update Accumulator and Flags
+	sbc8(OPB(1));
 
 	return true;
 }
@@ -2847,11 +5680,8 @@ bool Z80A::ANDR()
 	case 0b111: u8 = A_; break;
 	};
 
-	//Update Accumulator
-	A_ &= u8;
-	
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = 1; PF = isP(A_); NF = 0; CF = 0;
+	//Update Accumulator and Flags
+	and8(u8);
 	
 	return true;
 }
@@ -2859,11 +5689,8 @@ bool Z80A::ANDR()
 // ---- AND n
 bool Z80A::ANDN()
 {
-	//Update Accumulator
-	A_ &= OPB(1);
-
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = 1; PF = isP(A_); NF = 0; CF = 0;
+	//Update Accumulator and Flags
+	and8(OPB(1));
 		
 	return true;
 }
@@ -2887,11 +5714,8 @@ bool Z80A::ORR()
 	case 0b111: u8 = A_; break;
 	};
 
-	//Update Accumulator
-	A_ |= u8;
-	
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = 0; PF = isP(A_); NF = 0; CF = 0;
+	//Update Accumulator and Flags
+	or8(u8);
 	
 	return true;
 }
@@ -2899,11 +5723,8 @@ bool Z80A::ORR()
 // ---- OR n
 bool Z80A::ORN()
 {
-	//Update Accumulator
-	A_ |= OPB(1);
-
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = 0; PF = isP(A_); NF = 0; CF = 0;
+	//Update Accumulator and Flags
+	or8(OPB(1));
 
 	return true;
 }
@@ -2927,11 +5748,8 @@ bool Z80A::XORR()
 	case 0b111: u8 = A_; break;
 	};
 
-	//Update Accumulator
-	A_ ^= u8;
-	
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = 0; PF = isP(A_); NF = 0; CF = 0;
+	//Update Accumulator and Flags
+	xor8(u8);
 		
 	return true;
 }
@@ -2939,11 +5757,8 @@ bool Z80A::XORR()
 // ---- XOR n
 bool Z80A::XORN()
 {
-	//Update Accumulator
-	A_ ^= OPB(1);
-
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = 0; PF = isP(A_); NF = 0; CF = 0;
+	//Update Accumulator and Flags
+	xor8(OPB(1));
 
 	return true;
 }
@@ -2967,11 +5782,8 @@ bool Z80A::CPR()
 	case 0b111: u8 = A_; break;
 	};
 	
-	//Evaluate Result
-	res = A_ - u8;
-
-	//Update Flags
-	SF = (res >> 7); ZF = (res == 0); HF = isB(res, u8, 0, 4); PF = isU(res, u8, 0, 8); NF = 1; CF = isB(res, u8, 0, 8);
+	//Compare with Accumulator and Update Flags
+	cp8(u8);
 		
 	return true;
 }
@@ -2979,12 +5791,8 @@ bool Z80A::CPR()
 // ---- CP n
 bool Z80A::CPN()
 {
-	//Evaluate Result
-	u8 = OPB(1);
-	res = A_ - u8;
-
-	//Update Flags
-	SF = (res >> 7); ZF = (res == 0); HF = isB(res, u8, 0, 4); PF = isU(res, u8, 0, 8); NF = 1; CF = isB(res, u8, 0, 8);
+	//Compare with Accumulator and Update Flags
+	cp8(OPB(1));
 
 	return true;
 }
@@ -2995,24 +5803,21 @@ bool Z80A::INCR()
 {
 	uint8_t d = (ddprefix | fdprefix);
 
-	//Read from Register
+	//Update Register and Flags
 	switch ((OPB(d) >> 3) & 0x07)
 	{
-	case 0b000: u8 = ++B_; break;
-	case 0b001: u8 = ++C_; break;
-	case 0b010: u8 = ++D_; break;
-	case 0b011: u8 = ++E_; break;
-	case 0b100: u8 = (ddprefix) ? ++IXH_ : (fdprefix) ? ++IYH_ : ++H_; break;
-	case 0b101: u8 = (ddprefix) ? ++IXL_ : (fdprefix) ? ++IYL_ : ++L_; break;
-	case 0b110: (ddprefix) ? memWr(IX_ + (int8_t)OPB(2), u8 = memRd(IX_ + (int8_t)OPB(2)) + 1) : 
-		        (fdprefix) ? memWr(IY_ + (int8_t)OPB(2), u8 = memRd(IY_ + (int8_t)OPB(2)) + 1) : 
-							 memWr(HL_, u8 = memRd(HL_)+1); break;
-	case 0b111: u8 = ++A_; break;
+	case 0b000: B_ = inc8(B_); break;
+	case 0b001: C_ = inc8(C_); break;
+	case 0b010: D_ = inc8(D_); break;
+	case 0b011: E_ = inc8(E_); break;
+	case 0b100: (ddprefix) ? IXH_ = inc8(IXH_) : (fdprefix) ? IYH_ = inc8(IYH_) : H_ = inc8(H_); break;
+	case 0b101: (ddprefix) ? IXL_ = inc8(IXL_) : (fdprefix) ? IYL_ = inc8(IYL_) : L_ = inc8(L_); break;
+	case 0b110: (ddprefix) ? memWr(IX_ + (int8_t)OPB(2), inc8(memRd(IX_ + (int8_t)OPB(2)))) :
+				(fdprefix) ? memWr(IY_ + (int8_t)OPB(2), inc8(memRd(IY_ + (int8_t)OPB(2)))) :
+							 memWr(HL_, inc8(memRd(HL_))); break;
+	case 0b111: A_ = inc8(A_); break;
 	};
-			
-	//Update Flags
-	SF = (u8 >> 7); ZF = (u8 == 0); HF = isC(u8, 1, 0, 4); PF = (u8 == 0x80); NF = 0;
-		
+	
 	return true;
 }
 
@@ -3022,23 +5827,20 @@ bool Z80A::DECR()
 {
 	uint8_t d = (ddprefix | fdprefix);
 
-	//Read from Register
+	//Update Register and Flags
 	switch ((OPB(d) >> 3) & 0x07)
 	{
-	case 0b000: u8 = --B_; break;
-	case 0b001: u8 = --C_; break;
-	case 0b010: u8 = --D_; break;
-	case 0b011: u8 = --E_; break;
-	case 0b100: u8 = (ddprefix) ? --IXH_ : (fdprefix) ? --IYH_ : --H_; break;
-	case 0b101: u8 = (ddprefix) ? --IXL_ : (fdprefix) ? --IYL_ : --L_; break;
-	case 0b110: (ddprefix) ? memWr(IX_ + (int8_t)OPB(2), u8 = memRd(IX_ + (int8_t)OPB(2)) - 1) :
-				(fdprefix) ? memWr(IY_ + (int8_t)OPB(2), u8 = memRd(IY_ + (int8_t)OPB(2)) - 1) :
-		                     memWr(HL_, u8 = memRd(HL_) - 1); break;
-	case 0b111: u8 = --A_; break;
+	case 0b000: B_ = dec8(B_); break;
+	case 0b001: C_ = dec8(C_); break;
+	case 0b010: D_ = dec8(D_); break;
+	case 0b011: E_ = dec8(E_); break;
+	case 0b100: (ddprefix) ? IXH_ = dec8(IXH_) : (fdprefix) ? IYH_ = dec8(IYH_) : H_ = dec8(H_); break;
+	case 0b101: (ddprefix) ? IXL_ = dec8(IXL_) : (fdprefix) ? IYL_ = dec8(IYL_) : L_ = dec8(L_); break;
+	case 0b110: (ddprefix) ? memWr(IX_ + (int8_t)OPB(2), dec8(memRd(IX_ + (int8_t)OPB(2)))) :
+				(fdprefix) ? memWr(IY_ + (int8_t)OPB(2), dec8(memRd(IY_ + (int8_t)OPB(2)))) :
+							 memWr(HL_, dec8(memRd(HL_))); break;
+	case 0b111: A_ = dec8(A_); break;
 	};
-
-	//Update Flags
-	SF = (u8 >> 7); ZF = (u8 == 0); HF = isB(u8, 1, 0, 4); PF = (u8 == 0x7f); NF = 1;
 	
 	return true;
 }
@@ -3080,7 +5882,7 @@ bool Z80A::DAA()
 	}
 
 	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); PF = isP(A_);
+	F_ = (F_ & (XM | YM | HM | NM | CM)) | flagTable.SZP[A_];
 		
 	return true;
 }
@@ -3100,10 +5902,10 @@ bool Z80A::CPL()
 bool Z80A::NEG()
 {
 	u8 = A_;
-	A_ = 0x00 - A_;
+	A_ = 0x00;
 	
-	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = isB(A_, u8, 0, 4); PF = (u8 == 0x80); NF = 1; CF = (u8 != 0);
+	//Update Accumulator and Flags
+	sub8(u8);
 	
 	return true;
 }
@@ -3140,6 +5942,15 @@ bool Z80A::HALT()
 	bHalt = true;
 	PC_--;
 
+	//Only an Interrupt ends HALT and they are raised when run() ends, skip straight to the last
+	//HALT before the end of the run
+	uint64_t nPeriod = instSet[0x76].cycles1;
+	if (!nmi_latch && !irq_latch && (nRunEnd > nCycleCounter + nPeriod))
+	{
+		uint64_t nSkip = (nRunEnd - 1 - nCycleCounter) / nPeriod;
+		fastForward(nSkip * nPeriod, nSkip, nSkip);
+	}
+
 	return true;
 }
 
@@ -3437,7 +6248,7 @@ bool Z80A::RLCR()
 	};
 
 	//Update Flags
-	SF = (W_ >> 7); ZF = (W_ == 0); HF = 0; PF = isP(W_); NF = 0;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZP[W_];
 	
 	return true;
 }
@@ -3479,7 +6290,7 @@ bool Z80A::RLR()
 	};
 
 	//Update Flags
-	SF = (W_ >> 7); ZF = (W_ == 0); HF = 0; PF = isP(W_); NF = 0;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZP[W_];
 
 	return true;
 }
@@ -3520,7 +6331,7 @@ bool Z80A::RRCR()
 	};
 
 	//Update Flags
-	SF = (W_ >> 7); ZF = (W_ == 0); HF = 0; PF = isP(W_); NF = 0;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZP[W_];
 
 	return true;
 }
@@ -3562,7 +6373,7 @@ bool Z80A::RRR()
 	};
 
 	//Update Flags
-	SF = (W_ >> 7); ZF = (W_ == 0); HF = 0; PF = isP(W_); NF = 0;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZP[W_];
 
 	return true;
 }
@@ -3603,7 +6414,7 @@ bool Z80A::SLAR()
 	};
 
 	//Update Flags
-	SF = (W_ >> 7); ZF = (W_ == 0); HF = 0; PF = isP(W_); NF = 0;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZP[W_];
 
 	return true;
 }
@@ -3644,7 +6455,7 @@ bool Z80A::SRAR()
 	};
 
 	//Update Flags
-	SF = (W_ >> 7); ZF = (W_ == 0); HF = 0; PF = isP(W_); NF = 0;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZP[W_];
 
 	return true;
 }
@@ -3685,7 +6496,7 @@ bool Z80A::SLLR()
 	};
 
 	//Update Flags
-	SF = (W_ >> 7); ZF = (W_ == 0); HF = 0; PF = isP(W_); NF = 0;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZP[W_];
 
 	return true;
 }
@@ -3726,7 +6537,7 @@ bool Z80A::SRLR()
 	};
 
 	//Update Flags
-	SF = (W_ >> 7); ZF = (W_ == 0); HF = 0; PF = isP(W_); NF = 0;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZP[W_];
 
 	return true;
 }
@@ -3741,7 +6552,7 @@ bool Z80A::RLD()
 	memWr(HL_, Z_);
 	
 	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = 0; PF = isP(A_); NF = 0;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZP[A_];
 	
 	return true;
 }
@@ -3756,7 +6567,7 @@ bool Z80A::RRD()
 	memWr(HL_, Z_);
 
 	//Update Flags
-	SF = (A_ >> 7); ZF = (A_ == 0); HF = 0; PF = isP(A_); NF = 0;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZP[A_];
 
 	return true;
 }
@@ -3864,7 +6675,7 @@ bool Z80A::RESBR()
 // ---- JP nn
 bool Z80A::JPNN()
 {
-	PC_ = OPW(1);
+	jumpTo(OPW(1));
 	
 	return true;
 }
@@ -3874,14 +6685,14 @@ bool Z80A::JPCCNN()
 {
 	switch ((OPB(0) >> 3) & 0x07)
 	{
-	case 0b000: !ZF ? PC_ = OPW(1) : 0; break;
-	case 0b001: ZF ? PC_ = OPW(1) : 0; break;
-	case 0b010: !CF ? PC_ = OPW(1) : 0; break;
-	case 0b011: CF ? PC_ = OPW(1) : 0; break;
-	case 0b100: !PF ? PC_ = OPW(1) : 0; break;
-	case 0b101: PF ? PC_ = OPW(1) : 0; break;
-	case 0b110: !SF ? PC_ = OPW(1) : 0; break;
-	case 0b111: SF ? PC_ = OPW(1) : 0; break;
+	case 0b000: if (!ZF) jumpTo(OPW(1)); break;
+	case 0b001: if (ZF) jumpTo(OPW(1)); break;
+	case 0b010: if (!CF) jumpTo(OPW(1)); break;
+	case 0b011: if (CF) jumpTo(OPW(1)); break;
+	case 0b100: if (!PF) jumpTo(OPW(1)); break;
+	case 0b101: if (PF) jumpTo(OPW(1)); break;
+	case 0b110: if (!SF) jumpTo(OPW(1)); break;
+	case 0b111: if (SF) jumpTo(OPW(1)); break;
 	}
 
 	return true;
@@ -3890,7 +6701,7 @@ bool Z80A::JPCCNN()
 // ---- JR e
 bool Z80A::JRE()
 {
-	PC_ += (int8_t)OPB(1);
+	jumpTo(PC_ + (int8_t)OPB(1));
 
 	return true;
 }
@@ -3900,7 +6711,7 @@ bool Z80A::JRCE()
 {
 	if (CF)
 	{
-		PC_ += (int8_t)OPB(1);
+		jumpTo(PC_ + (int8_t)OPB(1));
 		return true;
 	}
 
@@ -3912,7 +6723,7 @@ bool Z80A::JRNCE()
 {
 	if (!CF)
 	{
-		PC_ += (int8_t)OPB(1);
+		jumpTo(PC_ + (int8_t)OPB(1));
 		return true;
 	}
 
@@ -3924,7 +6735,7 @@ bool Z80A::JRZE()
 {
 	if (ZF)
 	{
-		PC_ += (int8_t)OPB(1);
+		jumpTo(PC_ + (int8_t)OPB(1));
 		return true;
 	}
 
@@ -3936,7 +6747,7 @@ bool Z80A::JRNZE()
 {
 	if (!ZF)
 	{
-		PC_ += (int8_t)OPB(1);
+		jumpTo(PC_ + (int8_t)OPB(1));
 		return true;
 	}
 
@@ -3972,6 +6783,7 @@ bool Z80A::DJNZE()
 {
 	B_--;
 
+	//B changes on every iteration, a DJNZ loop is never idle
 	if (B_ != 0)
 	{
 		PC_ += (int8_t)OPB(1);
@@ -4110,7 +6922,7 @@ bool Z80A::INRiC()
 	};
 
 	//Update FLAGS
-	SF = (u8 >> 7); ZF = (u8 == 0); HF = 0; PF = isP(u8); NF = 0;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZP[u8];
 		
 	return true;
 }
@@ -4132,6 +6944,18 @@ bool Z80A::INI()
 bool Z80A::INIR()
 {
 	INI();
+
+	//Following iterations in bulk, each I/O access at its own timestamp
+	uint64_t nIter = std::min<uint64_t>(blockIterations(), B_);
+	while (nIter-- > 0)
+	{
+		//Stop before overwriting the Instruction itself
+		if ((uint16_t)(HL_ - (PC_ - 2)) < 2)
+			break;
+
+		fastForward(instSet[indexOp].cycles1, 1, 2);
+		INI();
+	}
 	
 	if (B_ != 0)
 	{
@@ -4160,6 +6984,18 @@ bool Z80A::IND()
 bool Z80A::INDR()
 {
 	IND();
+
+	//Following iterations in bulk, each I/O access at its own timestamp
+	uint64_t nIter = std::min<uint64_t>(blockIterations(), B_);
+	while (nIter-- > 0)
+	{
+		//Stop before overwriting the Instruction itself
+		if ((uint16_t)(HL_ - (PC_ - 2)) < 2)
+			break;
+
+		fastForward(instSet[indexOp].cycles1, 1, 2);
+		IND();
+	}
 	
 	if (B_ != 0)
 	{
@@ -4214,6 +7050,15 @@ bool Z80A::OUTI()
 bool Z80A::OTIR()
 {
 	OUTI();
+
+	//Following iterations in bulk, each I/O access at its own timestamp. The end of run() is
+	//checked again on each one, a VDP Register write can bring it forward
+	uint64_t nIter = std::min<uint64_t>(blockIterations(), B_);
+	while ((nIter-- > 0) && (blockIterations() > 0))
+	{
+		fastForward(instSet[indexOp].cycles1, 1, 2);
+		OUTI();
+	}
 	
 	if (B_ != 0)
 	{
@@ -4243,6 +7088,15 @@ bool Z80A::OTDR()
 {
 	OUTD();
 
+	//Following iterations in bulk, each I/O access at its own timestamp. The end of run() is
+	//checked again on each one, a VDP Register write can bring it forward
+	uint64_t nIter = std::min<uint64_t>(blockIterations(), B_);
+	while ((nIter-- > 0) && (blockIterations() > 0))
+	{
+		fastForward(instSet[indexOp].cycles1, 1, 2);
+		OUTD();
+	}
+
 	if (B_ != 0)
 	{
 		//Repeat Opcode
@@ -4268,7 +7122,7 @@ bool Z80A::INiC()
 	u8 = ioRd(C_);
 	
 	//Update FLAGS
-	SF = (u8 >> 7); ZF = (u8 == 0); HF = 0; PF = isP(u8); NF = 0;
+	F_ = (F_ & (XM | YM | CM)) | flagTable.SZP[u8];
 	
 	return true;
 }
@@ -4303,10 +7157,12 @@ bool Z80A::INVAL()
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //Maskable Interupts
+//Returns true if the Interrupt has been serviced
 bool Z80A::IRQEXEC()
 {
-	irq_latch = false;
+	bool bServiced = false;
 
+	irq_latch = false;
 
 	if (bIFF1)
 	{
@@ -4334,6 +7190,7 @@ bool Z80A::IRQEXEC()
 
 			//Set IM1 clock cycles
 			cycles = 13;
+			bServiced = true;
 			break;
 		case 2:
 			//Unsupported Mode by SMS
@@ -4341,7 +7198,7 @@ bool Z80A::IRQEXEC()
 		}
 	}
 
-	return true;
+	return bServiced;
 }
 
 //Non Maskable Interrupt
@@ -4435,7 +7292,7 @@ std::map<uint16_t, std::string> Z80A::disassemble(uint16_t nStart, uint16_t nSto
 		}
 
 		instrLen = instSet[indexOp].lenght;
-		sInst += instSet[indexOp].operation;
+		sInst += instName[indexOp];
 		if ((instrLen == 2) && (opcode[0] != 0xcb) && (opcode[0] != 0xdd) && (opcode[0] != 0xed) && (opcode[0] != 0xfd))
 		{
 			lo = opcode[1];
@@ -3,8 +3,12 @@
 #include<vector>
 #include<string>
 #include<map>
+#include<memory>
+#include<unordered_map>
 #include<iostream>
 
+#include "emuconst.h"
+
 class SMS;
 
 #define LITTLEENDIAN
@@ -56,6 +60,9 @@ class SMS;
 #define NF af.f.nf	//Add Subtract
 #define CF af.f.cf	//Carry Bit
 
+//Maximum number of Instructions in a Decoded Block
+#define MAXBLOCKLENGHT	32
+
 //OPCODE Direct Access Macro
 #define OPB(x) opcode[x]
 #define OPW(x) (opcode[x+1] << 8) + opcode[x]
@@ -136,9 +143,15 @@ public:
 	
 	//External Signal
 	bool clock();
+	int step();
+	int run(int budgetCycles);
+	void LimitRun(uint64_t nCycle);
+	void SetCore(CpuCore core);
 	bool reset();
 	bool irq();
 	bool nmi();
+	uint64_t GetCycleCounter() { return nCycleCounter; }
+	uint64_t GetInstrCounter() { return nInstrCounter; }
 	
 	// Produces a map of strings, with keys equivalent to instruction start locations
 	// in memory, for the specified address range
@@ -229,13 +242,25 @@ private:
 	////////////////////////////////////////////////////////////////////////////////
 	bool NMIEXEC();	bool IRQEXEC();
 
+	//Instruction Fetch, Decode & Execution
+	uint8_t fetch();
+	void decode();
+	void execute();
+
+	//Jump Helper Function, a Jump backwards goes thru the Idle Loop Detection
+	void jumpTo(uint16_t addr);
+
 	//Helper Function
-	bool isP(uint8_t res);
 	bool isC(uint32_t res, uint32_t b, uint8_t c, uint8_t bit);
 	bool isB(uint32_t res, uint32_t b, uint8_t c, uint8_t bit);
 	bool isO(uint32_t res, uint32_t b, uint8_t c, uint8_t bit);
 	bool isU(uint32_t res, uint32_t b, uint8_t c, uint8_t bit);
 
+	//8-Bit ALU Helper Function
+	void add8(uint8_t v);	void adc8(uint8_t v);	void sub8(uint8_t v);	void sbc8(uint8_t v);
+	void and8(uint8_t v);	void or8(uint8_t v);	void xor8(uint8_t v);	void cp8(uint8_t v);
+	uint8_t inc8(uint8_t v);	uint8_t dec8(uint8_t v);
+
 	// Read-Write instruction from Stack, Memory and I/O Ports
 	uint8_t		memRd(uint16_t addr);
 	bool		memWr(uint16_t addr, uint8_t data);
@@ -256,7 +281,9 @@ private:
 
 	//Contains the number of clock ticks to complete the instruction now in execution
 	uint8_t  cycles = 0;
-	uint32_t nCycleCounter;
+	uint8_t  ticks = 0;						//Clock ticks left before clock() executes the next Instruction
+	uint64_t nCycleCounter;					//Clock cycles executed since reset, at the start of the current Instruction
+	uint64_t nInstrCounter;					//Instructions executed since reset, used for benchmarking
 
 	//OPcode PLA Status
 	bool cbprefix, ddprefix, edprefix, fdprefix, ddcbprefix, fdcbprefix;
@@ -271,14 +298,98 @@ private:
 	// Z80 Instruction Dictionaries
 	struct INSTRUCTION
 	{
-		std::string operation;
 		bool(Z80A::*operate)() = nullptr;
 		uint8_t cycles1 = 0;
 		uint8_t cycles2 = 0;
 		uint8_t lenght = 0;
 	};
 	
-	//Full set of Instruction Dictionaries
-	std::vector<INSTRUCTION> instSet;		//Full Instruction Set
+	//Full set of Instruction Dictionaries, built at compile time
+	static const INSTRUCTION instSet[0x700];	//Full Instruction Set - Hot Table
+	static const char* const instName[0x700];	//Instruction Mnemonics - Cold Table, Disassembler Only
+
+	//Decoded Block Cache, each Instruction is decoded once: Handler, clock cycles, Operands
+	//and Prefix Group are cached and the Handler is called straight from the Block
+	struct DECODED
+	{
+		bool(Z80A::*operate)() = nullptr;
+		std::array<uint8_t, 4> opcode;		//Opcode and Operands
+		uint16_t indexOp = 0;
+		uint8_t cycles1 = 0;
+		uint8_t cycles2 = 0;
+		uint8_t lenght = 0;
+		uint8_t offset = 0;					//Instruction Offset from the Block start
+	};
+
+	struct BLOCK
+	{
+		std::vector<DECODED> ops;
+		BLOCK* pNext = nullptr;				//Block run next last time, valid at nNextPC with the same Memory Map
+		uint16_t nNextPC = 0;
+		uint32_t nNextGeneration = 0;
+	};
+
+	CpuCore cpuCore = CpuCore::INTERPRETER;
+	std::unordered_map<uint32_t, BLOCK> blockCache;	//Decoded Blocks by ROM Address
+
+	void runBlocks();
+	void executeDecoded(const DECODED& op);
+
+	//Differential Mode, each cached Instruction is executed again by the Interpreter on a shadow
+	//CPU starting from the same state, the Registers and the Cycle Counter must match. The shadow
+	//has no side effects: the cached Instruction records its Bus accesses and the shadow replays them
+	struct DIFFBUS
+	{
+		bool bReplay = false;						//Recording on the CPU or replaying on the shadow
+		std::array<uint8_t, 4> fetch;				//Opcode bytes before the Instruction
+		std::array<uint8_t, 0x10000> memOld;		//Memory content before the first write
+		std::array<uint8_t, 0x10000> memNew;		//Memory written by the shadow
+		std::array<uint8_t, 0x10000> memFlags{};	//MEMOLD and MEMNEW
+		std::vector<uint16_t> memTouched;			//Addresses with any flag set
+		std::vector<uint8_t> ioRead;				//I/O Port reads, in order
+		std::vector<uint64_t> query;				//Cycle limits and Block iterations, in order
+		size_t nIoRead = 0;
+		size_t nQuery = 0;
+
+		enum { MEMOLD = 0x01, MEMNEW = 0x02 };
+
+		void clear();
+		uint8_t nextIoRead() { return (nIoRead < ioRead.size()) ? ioRead[nIoRead++] : 0xff; }
+		uint64_t nextQuery() { return (nQuery < query.size()) ? query[nQuery++] : 0; }
+	};
+
+	std::unique_ptr<Z80A> pShadow;					//Interpreter shadow CPU, Differential Mode only
+	std::unique_ptr<DIFFBUS> pDiffBus;
+	DIFFBUS* pDiff = nullptr;						//Bus journal, set while an Instruction is checked
+
+	bool diffExecute(const DECODED& op);
+	void copyState(const Z80A& cpu);
+
+	//Threaded Interpreter
+	void runThreaded();
+	BLOCK decodeBlock(uint16_t addr, uint32_t romaddr);
+	bool isBlockEnd(uint16_t index);
+
+	//Idle Loop, HALT & Block Transfer Fast-Forward
+	uint64_t nRunEnd = 0;					//Cycle Counter at which run() stops, 0 outside run()
+
+	//All the Registers but R and PC, IFF and Interrupt Mode included
+	typedef std::array<uint16_t, 14> IDLESTATE;
+
+	IDLESTATE idleState{};					//Registers at the head of the loop being probed
+	uint16_t nIdlePC = 0;					//Head of the loop being probed
+	uint64_t nIdleCycle = 0;				//Cycle Counter, Instruction Counter and R at the loop head
+	uint64_t nIdleInstr = 0;
+	uint8_t nIdleR = 0;
+	uint32_t nIdleGeneration = 0;			//VDP Status Generation before the first VDP Port read
+	bool bIdleDirty = true;					//Loop iteration wrote memory, I/O or read an unsafe Port
+	bool bIdleVdp = false;					//Loop iteration read the V Counter or the VDP Status
+	bool bIdleStatus = false;				//Loop iteration read the VDP Status
+
+	IDLESTATE getIdleState();
+	void idleLoop();
+	void fastForward(uint64_t nCycles, uint64_t nInstr, uint64_t nRefresh);
+	uint64_t blockIterations();
+	uint16_t blockCopy(uint32_t nMax, int nStep);
 };
 
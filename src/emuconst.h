@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 
 //Define Console Platforms
 enum class ConsolePlatform : uint8_t
@@ -22,3 +23,11 @@ enum class ConsoleMapper : uint8_t
 	CODEMASTER = 0x2
 };
 
+//Define CPU Cores
+enum class CpuCore : uint8_t
+{
+	INTERPRETER = 0x1,
+	BLOCKCACHE = 0x2,
+	DIFFERENTIAL = 0x3,
+	THREADED = 0x4
+};
@@ -19,6 +19,13 @@ int main(int argc, char* argv[])
     //Init Emulator Object
     SegaEmu emu;
 
+    //Run the Benchmark without initializing SDL
+    if (commandline::getBenchFrames() > 0)
+    {
+        emu.RunBenchmark(commandline::getBenchFrames());
+        return 0;
+    }
+
     //Init SDL Platform
     if (!emu.InitSystem(DEFAULT_SCREEN_WIDTH, DEFAULT_SCREEN_HEIGHT))
     {
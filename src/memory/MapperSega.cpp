@@ -2,11 +2,12 @@
 #include "mapper.h"
 #include "mappersega.h"
 
-MapperSega::MapperSega(uint8_t* cROM, uint8_t* cRAM)
+MapperSega::MapperSega(uint8_t* cROM, uint8_t* cRAM, uint32_t romsize)
 {
 	//Initialize POinter to Cartridge ROM & RAM
 	pROM = cROM;
 	pRAM = cRAM;
+	nRomSize = romsize;
 
 	//Reset Mapper Control Registers to Default Values
 	mapper_control[0] = 0x00;	//FFFCh - Cartridge RAM Mapper Control
@@ -45,7 +46,7 @@ bool MapperSega::readMap(uint16_t addr, uint8_t& data)
 	else if (addr >= 0x8000 && addr <= 0xbfff)
 	{
 		//Check if reads from ROM Slot 2 or RAM Slot 2
-		if ((mapper_control[0] & 0x08) == 1)
+		if ((mapper_control[0] & 0x08) != 0)
 		{
 			//Check Cartridge RAM Bank Selection
 			if ((mapper_control[0] & 0x04) == 0)
@@ -69,7 +70,7 @@ bool MapperSega::readMap(uint16_t addr, uint8_t& data)
 	else if (addr >= 0xc000 && addr <= 0xffff)
 	{
 		//Check if RAM Slot 3 is enabled
-		if ((mapper_control[0] & 0x10) == 1)
+		if ((mapper_control[0] & 0x10) != 0)
 		{
 			//Check Cartridge RAM Bank Selection
 			if ((mapper_control[0] & 0x04) == 0)
@@ -93,7 +94,7 @@ bool MapperSega::writeMap(uint16_t addr, uint8_t data)
 	if (addr >= 0x8000 && addr <= 0xbfff)
 	{
 		//Check if RAM Slot 2 is enabled - (0x8000 - 0xbfff)
-		if ((mapper_control[0] & 0x08) == 1)
+		if ((mapper_control[0] & 0x08) != 0)
 		{
 			//Check Cartridge RAM Bank Selection
 			if ((mapper_control[0] & 0x04) == 0)
@@ -111,7 +112,7 @@ bool MapperSega::writeMap(uint16_t addr, uint8_t data)
 	else if (addr >= 0xc000 && addr <= 0xffff)
 	{
 		//Check if RAM Slot 3 is enabled - (0xc000 - 0xffff)
-		if ((mapper_control[0] & 0x10) == 1)
+		if ((mapper_control[0] & 0x10) != 0)
 		{
 			//Check Cartridge RAM Bank Selection
 			if ((mapper_control[0] & 0x04) == 0)
@@ -146,3 +147,64 @@ bool MapperSega::writeMap(uint16_t addr, uint8_t data)
 
 	return true;
 }
+
+bool MapperSega::romMap(uint16_t addr, uint32_t& mapped_addr)
+{
+	//Translate Address to Cartridge ROM Address according to Mapper Control Register
+	if (addr <= 0x03ff)
+	{
+		//First 1K is never Mapped, contains interrupt routines
+		mapped_addr = addr;
+		return true;
+	}
+	else if (addr <= 0x3fff)
+	{
+		//ROM Slot 0
+		mapped_addr = addr + mapper_control[1] * 0x4000;
+		return true;
+	}
+	else if (addr <= 0x7fff)
+	{
+		//ROM Slot 1
+		mapped_addr = (addr - 0x4000) + (mapper_control[2] * 0x4000);
+		return true;
+	}
+	else if (addr <= 0xbfff && (mapper_control[0] & 0x08) == 0)
+	{
+		//ROM Slot 2, unless Cartridge RAM is mapped on it
+		mapped_addr = (addr - 0x8000) + mapper_control[3] * 0x4000;
+		return true;
+	}
+
+	return false;
+}
+
+uint8_t* MapperSega::readPtr(uint16_t addr)
+{
+	uint32_t mapped_addr;
+
+	//Cartridge RAM mapped on Slot 2 or Slot 3
+	if (addr >= 0x8000 && addr <= 0xbfff && (mapper_control[0] & 0x08) != 0)
+		return pRAM + ((mapper_control[0] & 0x04) ? 0x4000 : 0x0000) + (addr & 0x3fff);
+
+	if (addr >= 0xc000)
+		return ((mapper_control[0] & 0x10) != 0) ? pRAM + ((mapper_control[0] & 0x04) ? 0x0000 : 0x4000) + (addr & 0x3fff) : nullptr;
+
+	//Cartridge ROM, pages outside the ROM image are left to readMap
+	if (romMap(addr, mapped_addr) && (mapped_addr + 0x0400) <= nRomSize)
+		return pROM + mapped_addr;
+
+	return nullptr;
+}
+
+uint8_t* MapperSega::writePtr(uint16_t addr)
+{
+	//Only Cartridge RAM is writable, ROM pages are read only
+	if (addr >= 0x8000 && addr <= 0xbfff && (mapper_control[0] & 0x08) != 0)
+		return pRAM + ((mapper_control[0] & 0x04) ? 0x4000 : 0x0000) + (addr & 0x3fff);
+
+	if (addr >= 0xc000 && (mapper_control[0] & 0x10) != 0)
+		return pRAM + ((mapper_control[0] & 0x04) ? 0x0000 : 0x4000) + (addr & 0x3fff);
+
+	return nullptr;
+}
@@ -54,3 +54,12 @@ bool Bios::write(uint16_t addr, uint8_t data)
 
 	return true;
 }
+
+uint8_t* Bios::readPtr(uint16_t addr)
+{
+	//Host pointer to the 1K page starting at addr, if it's inside the ROM image
+	if ((addr + 0x0400u) <= bROM.size())
+		return bROM.data() + addr;
+
+	return nullptr;
+}
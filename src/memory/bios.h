@@ -19,6 +19,7 @@ private:
 public:
 	bool read(uint16_t addr, uint8_t& data);
 	bool write(uint16_t addr, uint8_t data);
+	uint8_t* readPtr(uint16_t addr);
 
 
 };
@@ -5,6 +5,8 @@ Cartridge::Cartridge(const std::string& filename, ConsoleMapper mapper)
 {
 	uint32_t romsize;
 	uint16_t header_addr;
+
+	nRomSize = 0;
 		
 	//Load ROM Image
 	std::ifstream ifs;
@@ -21,8 +23,9 @@ Cartridge::Cartridge(const std::string& filename, ConsoleMapper mapper)
 
 		//cROM.resize(rompages * 16384);
 		//ifs.read((char*)cROM.data(), cROM.size());
-		cROM = new uint8_t[rompages * 16384];
-		ifs.read((char*)cROM, rompages * 16384);
+		nRomSize = rompages * 16384;
+		cROM = new uint8_t[nRomSize];
+		ifs.read((char*)cROM, nRomSize);
 		ifs.close();
 		LOG_F(INFO, "CRT - Game File Loaded: %s, Size: %d bytes, Pages: %d", filename.c_str(), romsize, rompages);
 	}
@@ -59,8 +62,8 @@ Cartridge::Cartridge(const std::string& filename, ConsoleMapper mapper)
 	//Initialize Memory Mapper
 	switch (mapper)
 	{
-	case ConsoleMapper::SEGA:		pMapper = std::make_shared<MapperSega>(cROM, cRAM); break;
-	case ConsoleMapper::CODEMASTER:	pMapper = std::make_shared<MapperCodemaster>(cROM, cRAM); break;
+	case ConsoleMapper::SEGA:		pMapper = std::make_shared<MapperSega>(cROM, cRAM, nRomSize); break;
+	case ConsoleMapper::CODEMASTER:	pMapper = std::make_shared<MapperCodemaster>(cROM, cRAM, nRomSize); break;
 	}
 }
 
@@ -84,3 +87,18 @@ bool Cartridge::write(uint16_t addr, uint8_t data)
 	return true;
 }
 
+bool Cartridge::romMap(uint16_t addr, uint32_t& romaddr)
+{
+	return pMapper->romMap(addr, romaddr);
+}
+
+uint8_t* Cartridge::readPtr(uint16_t addr)
+{
+	return pMapper->readPtr(addr);
+}
+
+uint8_t* Cartridge::writePtr(uint16_t addr)
+{
+	return pMapper->writePtr(addr);
+}
+
@@ -22,6 +22,7 @@ private:
 	//Cartridge ROM & RAM Memory
 	uint8_t* cROM;
 	uint8_t* cRAM;
+	uint32_t nRomSize;
 
 	//Memory Mapper
 	std::shared_ptr<Mapper> pMapper;
@@ -36,5 +37,8 @@ private:
 public:
 	bool read(uint16_t addr, uint8_t &data);
 	bool write(uint16_t addr, uint8_t data);
+	bool romMap(uint16_t addr, uint32_t& romaddr);
+	uint8_t* readPtr(uint16_t addr);
+	uint8_t* writePtr(uint16_t addr);
 };
 
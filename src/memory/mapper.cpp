@@ -4,6 +4,7 @@ Mapper::Mapper()
 {
 	pROM = NULL;
 	pRAM = NULL;
+	nRomSize = 0;
 }
 
 //Mapper::Mapper(uint8_t* cROM, uint8_t* cRAM)
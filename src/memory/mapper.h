@@ -11,8 +11,14 @@ public:
 	//Virtual Members, defined by derived class for each Mapper implementation
 	virtual bool readMap(uint16_t addr, uint8_t& data) = 0;
 	virtual bool writeMap(uint16_t addr, uint8_t data) = 0;
+	virtual bool romMap(uint16_t addr, uint32_t& mapped_addr) = 0;
+
+	//Host pointer to the 1K page starting at addr, nullptr if the page can't be accessed directly
+	virtual uint8_t* readPtr(uint16_t addr) = 0;
+	virtual uint8_t* writePtr(uint16_t addr) = 0;
 
 public:
 	uint8_t* pROM;
 	uint8_t* pRAM;
+	uint32_t nRomSize;
 };
@@ -1,7 +1,7 @@
 #include "mapper.h"
 #include "mappercodemaster.h"
 
-MapperCodemaster::MapperCodemaster(uint8_t* cROM, uint8_t* cRAM)
+MapperCodemaster::MapperCodemaster(uint8_t* cROM, uint8_t* cRAM, uint32_t romsize)
 {
 }
 
@@ -18,3 +18,18 @@ bool MapperCodemaster::writeMap(uint16_t addr, uint8_t data)
 {
 	return false;
 }
+
+bool MapperCodemaster::romMap(uint16_t addr, uint32_t& mapped_addr)
+{
+	return false;
+}
+
+uint8_t* MapperCodemaster::readPtr(uint16_t addr)
+{
+	return nullptr;
+}
+
+uint8_t* MapperCodemaster::writePtr(uint16_t addr)
+{
+	return nullptr;
+}
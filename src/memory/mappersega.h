@@ -4,12 +4,15 @@
 class MapperSega : public Mapper
 {
 public:
-	MapperSega(uint8_t* cROM, uint8_t* cRAM);
+	MapperSega(uint8_t* cROM, uint8_t* cRAM, uint32_t romsize);
 	~MapperSega();
 
 	//Virtual Members, defined by derived class for each Mapper implementation
 	bool readMap(uint16_t addr, uint8_t& data) override;
 	bool writeMap(uint16_t addr, uint8_t data) override;
+	bool romMap(uint16_t addr, uint32_t& mapped_addr) override;
+	uint8_t* readPtr(uint16_t addr) override;
+	uint8_t* writePtr(uint16_t addr) override;
 
 public:
 	//Mapper Registers
@@ -2,15 +2,19 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <algorithm>
 #include <chrono>
 #include <SDL3/SDL.h>
 
 #include "emuconst.h"
 #include "sms.h"
+#include "renderthread.h"
 
 constexpr auto MINIMUM_SCREEN_WIDTH = 640;
 constexpr auto MINIMUM_SCREEN_HEIGHT = 480;
 constexpr auto MAX_GAMEPADS = 2;
+constexpr auto MAX_ADAPTIVE_FRAMESKIP = 4;
 
 //Emulator Class Definition
 class SegaEmu
@@ -23,6 +27,7 @@ public:
 
 	bool InitSystem(int wndWidth, int wndHeight);
 	bool InitEmulator(ConsolePlatform platform);
+	bool RunBenchmark(int frames);
 	bool HandleEvents();
 	bool NewFrame();
 	bool RenderFrame();
@@ -34,17 +39,25 @@ public:
 	bool						isRunning;
 
 private:
+	void InitSettings();
+	SDL_PixelFormat GetScreenFormat();
+
 	ConsolePlatform				selectedPlatform;
 	ConsoleRegion				selectedRegion;
 	ConsoleMapper				selectedMapper;
+	CpuCore						selectedCore;
+	bool						bRenderThread;			//Render the Frames on a Render Thread
+	uint8_t						nFrameSkip;				//Frames skipped after each rendered one, or at most in a row
+	bool						bAdaptiveSkip;			//Skip Frames only while the Host is late
 	std::string					gameFileName;
 
 	SDL_Event					sdlEvent;
 	SDL_Window*					pWindow;
 	SDL_AudioStream*            activeAudioStream;		//Audio Stream used to queue audio samples to the active audio device	
-	SDL_Surface*				pScreenSurface;
-	SDL_Surface*				pFrameBuffer;
+	SDL_Renderer*				pRenderer;				//Scales the Screen Texture to the Window
+	SDL_Texture*				pScreenTexture;			//Streaming Texture the VDP draws into
 	SDL_Surface*				pOverlay;
+	RenderThread*				pRenderThread;
 
 	//Windows Size
 	int							windowWidth;
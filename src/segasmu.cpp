@@ -7,9 +7,10 @@ SegaEmu::SegaEmu()
     isRunning = false;
 
     pWindow = nullptr;
-    pScreenSurface = nullptr;
+    pRenderer = nullptr;
+    pScreenTexture = nullptr;
     pOverlay = nullptr;
-    pFrameBuffer = nullptr;
+    pRenderThread = nullptr;
 
     windowWidth = 0;
 	windowHeight = 0;
@@ -53,8 +54,19 @@ bool SegaEmu::InitSystem(int scrWidth, int scrHeight)
     SDL_SetWindowMinimumSize(pWindow, MINIMUM_SCREEN_WIDTH, MINIMUM_SCREEN_HEIGHT);
 
     LOG_F(INFO, "Window created...");
-    //Get window surface
-    pScreenSurface = SDL_GetWindowSurface(pWindow);
+
+    //Create the Renderer, it scales the Screen Texture to the Window. Fall back to the software
+    //renderer when there's no GPU
+    pRenderer = SDL_CreateRenderer(pWindow, NULL);
+    if (pRenderer == nullptr)
+        pRenderer = SDL_CreateRenderer(pWindow, SDL_SOFTWARE_RENDERER);
+    if (pRenderer == nullptr)
+    {
+        LOG_F(ERROR, "Renderer could not be created! SDL_Error: %s", SDL_GetError());
+        return false;
+    }
+
+    LOG_F(INFO, "Renderer created [%s]...", SDL_GetRendererName(pRenderer));
     
     //Init Audio Device Stream - use default audio device for playback
     SDL_AudioSpec spec;
@@ -94,6 +106,90 @@ bool SegaEmu::InitEmulator(ConsolePlatform platform)
     selectedPlatform = platform;
 	LOG_F(INFO, "EMU - Selected Platform: %s", selectedPlatform == ConsolePlatform::MASTERSYSTEM ? "Master System" : "Megadrive");
 
+	//Init Settings from Command Line
+	InitSettings();
+
+	//Init Platform Object and FrameBuffer
+    switch (selectedPlatform)
+    {
+    case ConsolePlatform::MASTERSYSTEM:
+        
+        sms = new SMS(selectedRegion, selectedMapper, gameFileName);
+        sms->cpu.SetCore(selectedCore);
+        sms->SetFrameSkip(nFrameSkip, bAdaptiveSkip);
+        if (bRenderThread)
+        {
+            pRenderThread = new RenderThread();
+            sms->vdp.AttachRenderThread(pRenderThread);
+        }
+        pScreenTexture = SDL_CreateTexture(pRenderer, GetScreenFormat(), SDL_TEXTUREACCESS_STREAMING, 256, 240);
+        if (pScreenTexture == nullptr)
+        {
+            LOG_F(ERROR, "EMU - Screen Texture could not be created! SDL_Error: %s", SDL_GetError());
+            return false;
+        }
+        SDL_SetTextureScaleMode(pScreenTexture, SDL_SCALEMODE_NEAREST);
+	    frameDuration = sms->GetFrameDuration();
+		break;
+    
+    case ConsolePlatform::MEGADRIVE:
+		//TODO - Implement Megadrive Emulator
+        break;
+    }
+
+    SDL_ClearAudioStream(activeAudioStream);
+    return true;
+}
+
+//Run the Game headless for the given number of frames once per CPU Core and report
+//the emulation speed. Video and Audio are emulated but not presented
+bool SegaEmu::RunBenchmark(int frames)
+{
+	const CpuCore cores[] = { CpuCore::INTERPRETER, CpuCore::BLOCKCACHE, CpuCore::THREADED };
+	const char* names[] = { "Interpreter", "Block Cache", "Threaded" };
+
+	//Init Settings from Command Line
+	InitSettings();
+
+	printf("Benchmark - %s, %d frames\n", gameFileName.c_str(), frames);
+
+	for (int i = 0; i < 3; i++)
+	{
+		SMS* bench = new SMS(selectedRegion, selectedMapper, gameFileName);
+		bench->cpu.SetCore(cores[i]);
+		bench->SetFrameSkip(nFrameSkip, bAdaptiveSkip);
+		RenderThread* renderThread = bRenderThread ? new RenderThread() : nullptr;
+		bench->vdp.AttachRenderThread(renderThread);
+
+		auto start = std::chrono::steady_clock::now();
+
+		for (int f = 0; f < frames; f++)
+		{
+			bench->NewFrame();
+
+			//Drain Audio Samples as the Audio Stream would do
+			int samples = bench->psg.GetSamplePerFrame();
+			for (int s = 0; s < samples; s++)
+				bench->psg.GetSample();
+		}
+
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		double seconds = elapsed.count();
+		double mips = bench->cpu.GetInstrCounter() / seconds / 1000000.0;
+		double fps = frames / seconds;
+
+		printf("  %-12s %8.3f s  %8.2f MIPS  %8.1f fps\n", names[i], seconds, mips, fps);
+		LOG_F(INFO, "EMU - Benchmark %s: %.3f s, %.2f MIPS, %.1f fps", names[i], seconds, mips, fps);
+
+		delete bench;
+		delete renderThread;
+	}
+
+	return true;
+}
+
+void SegaEmu::InitSettings()
+{
 	//Init Game FileName from Command Line
 	gameFileName = commandline::getBinFileName();
 	LOG_F(INFO, "EMU - Game Filename: %s", gameFileName.c_str());
@@ -116,23 +212,30 @@ bool SegaEmu::InitEmulator(ConsolePlatform platform)
 		selectedRegion = ConsoleRegion::EU;
 	LOG_F(INFO, "EMU - Selected Region: %s", selectedRegion == ConsoleRegion::JP ? "Japan" : selectedRegion == ConsoleRegion::US ? "USA" : "Europe");
 
-	//Init Platform Object and FrameBuffer
-    switch (selectedPlatform)
-    {
-    case ConsolePlatform::MASTERSYSTEM:
-        
-        sms = new SMS(selectedRegion, selectedMapper, gameFileName);
-        pFrameBuffer = SDL_CreateSurface(256, 192, SDL_PIXELFORMAT_ARGB8888);
-	    frameDuration = sms->GetFrameDuration();
-		break;
-    
-    case ConsolePlatform::MEGADRIVE:
-		//TODO - Implement Megadrive Emulator
-        break;
-    }
-
-    SDL_ClearAudioStream(activeAudioStream);
-    return true;
+	//Init CPU Core from Command Line, Interpreter is the default
+	std::string core = commandline::getCpuCore();
+	selectedCore = CpuCore::INTERPRETER;
+	if (core == "BLOCK")
+		selectedCore = CpuCore::BLOCKCACHE;
+	if (core == "DIFF")
+		selectedCore = CpuCore::DIFFERENTIAL;
+	if (core == "THREAD")
+		selectedCore = CpuCore::THREADED;
+	LOG_F(INFO, "EMU - Selected CPU Core: %s", selectedCore == CpuCore::INTERPRETER ? "Interpreter" : selectedCore == CpuCore::BLOCKCACHE ? "Block Cache" :
+		selectedCore == CpuCore::DIFFERENTIAL ? "Differential" : "Threaded");
+
+	//Init Video Renderer from Command Line, Frames are rendered on the emulation thread by default
+	bRenderThread = (commandline::getRenderer() == "THREAD");
+	LOG_F(INFO, "EMU - Selected Video Renderer: %s", bRenderThread ? "Render Thread" : "Synchronous");
+
+	//Init Frameskip from Command Line, every Frame is rendered by default
+	std::string frameskip = commandline::getFrameSkip();
+	bAdaptiveSkip = (frameskip == "AUTO");
+	nFrameSkip = bAdaptiveSkip ? MAX_ADAPTIVE_FRAMESKIP : (uint8_t)std::clamp(std::atoi(frameskip.c_str()), 0, 9);
+	if (bAdaptiveSkip)
+		LOG_F(INFO, "EMU - Selected Frameskip: Adaptive, up to %d Frames", nFrameSkip);
+	else
+		LOG_F(INFO, "EMU - Selected Frameskip: %d Frames", nFrameSkip);
 }
 
 bool SegaEmu::HandleEvents()
@@ -151,7 +254,6 @@ bool SegaEmu::HandleEvents()
             windowHeight = sdlEvent.window.data2;
             windowWidth = windowHeight * 4 / 3;  //Force 4/3 Ratio
             SDL_SetWindowSize(pWindow, windowWidth, windowHeight);
-            pScreenSurface = SDL_GetWindowSurface(pWindow);
             break;
 
         case SDL_EVENT_GAMEPAD_REMOVED:     //Detect Removed Gamepad
@@ -237,41 +339,85 @@ bool SegaEmu::NewFrame()
     return false;
 }
 
+//Pick the first Texture format preferred by the Renderer the VDP can draw in, and set the VDP Host
+//Palette to it, so Frames don't need any conversion on the way to the screen
+SDL_PixelFormat SegaEmu::GetScreenFormat()
+{
+    const SDL_PixelFormat* formats = (const SDL_PixelFormat*)SDL_GetPointerProperty(SDL_GetRendererProperties(pRenderer), SDL_PROP_RENDERER_TEXTURE_FORMATS_POINTER, NULL);
+
+    for (; (formats != NULL) && (*formats != SDL_PIXELFORMAT_UNKNOWN); formats++)
+    {
+        switch (*formats)
+        {
+        case SDL_PIXELFORMAT_ARGB8888: sms->vdp.SetPixelFormat(VDP::ARGB8888); break;
+        case SDL_PIXELFORMAT_XRGB8888: sms->vdp.SetPixelFormat(VDP::XRGB8888); break;
+        case SDL_PIXELFORMAT_RGB565: sms->vdp.SetPixelFormat(VDP::RGB565); break;
+        default: continue;
+        }
+
+        LOG_F(INFO, "EMU - Screen Texture format: %s", SDL_GetPixelFormatName(*formats));
+        return *formats;
+    }
+
+    sms->vdp.SetPixelFormat(VDP::ARGB8888);
+    return SDL_PIXELFORMAT_ARGB8888;
+}
+
 bool SegaEmu::RenderFrame()
 {
-    //Copy FrameBuffer to ScreenSurface
-    if (!SDL_LockSurface(pFrameBuffer))
+    //Skipped Frames have nothing to present, keep the one on screen
+    if (sms->IsFrameSkipped())
+        return true;
+
+    //Get the newest Frame from the Render Thread, keep the one on screen if there's none
+    const uint32_t* screen = nullptr;
+    if (pRenderThread != nullptr)
     {
-        LOG_F(ERROR, "EMU - Error while locking ScreenSurface: %s", SDL_GetError());
-        return false;
+        screen = pRenderThread->AcquireFrame();
+        if (screen == nullptr)
+            return true;
     }
-    
-    SDL_memcpy(
-        pFrameBuffer->pixels,
-        sms->vdp.GetScreen(),
-        sms->vdp.GetScreenWidth() * sms->vdp.GetScreenHeight() * sizeof(uint32_t));
-    SDL_UnlockSurface(pFrameBuffer);
-    
-    SDL_Rect rect;
-    rect.x = 0;
-    rect.y = 0;
 
-    if (!SDL_GetWindowSize(pWindow, &rect.w, &rect.h))
+    //Lock the visible lines of the Screen Texture. The VDP draws straight into it, Frames from the
+    //Render Thread are copied a line at a time
+    int width = sms->vdp.GetScreenWidth();
+    int height = sms->vdp.GetScreenHeight();
+    SDL_Rect area = { 0, 0, width, height };
+    void* pixels;
+    int pitch;
+
+    if (!SDL_LockTexture(pScreenTexture, &area, &pixels, &pitch))
     {
-        LOG_F(ERROR, "EMU - Error while getting Window Size: %s", SDL_GetError());
+        LOG_F(ERROR, "EMU - Error while locking Screen Texture: %s", SDL_GetError());
+        if (pRenderThread != nullptr)
+            pRenderThread->ReleaseFrame();
         return false;
     }
 
-    if (!SDL_BlitSurfaceScaled(pFrameBuffer, NULL, pScreenSurface, &rect, SDL_SCALEMODE_NEAREST))
+    if (screen != nullptr)
     {
-        LOG_F(ERROR, "EMU - Error while blitting Surface: %s", SDL_GetError());
+        for (int y = 0; y < height; y++)
+            SDL_memcpy((uint8_t*)pixels + y * pitch, screen + y * 256, width * sms->vdp.GetPixelSize());
+        pRenderThread->ReleaseFrame();
+    }
+    else
+    {
+        sms->vdp.DrawScreen(pixels, pitch);
+    }
+    SDL_UnlockTexture(pScreenTexture);
+
+    //Scale the visible lines to the whole Window
+    SDL_FRect src = { 0.0f, 0.0f, (float)width, (float)height };
+    if (!SDL_RenderTexture(pRenderer, pScreenTexture, &src, NULL))
+    {
+        LOG_F(ERROR, "EMU - Error while rendering Screen Texture: %s", SDL_GetError());
         return false;
     }
 
     //Update the Windows
-    if (!SDL_UpdateWindowSurface(pWindow))
+    if (!SDL_RenderPresent(pRenderer))
     {
-        LOG_F(ERROR, "EMU - Error while updating Window Surface: %s", SDL_GetError());
+        LOG_F(ERROR, "EMU - Error while presenting Renderer: %s", SDL_GetError());
         return false;
     }
 
@@ -284,9 +430,21 @@ void SegaEmu::Close()
     SDL_CloseGamepad(Gamepad[0]);
     SDL_CloseGamepad(Gamepad[1]);
 
+    //Stop the Render Thread
+    if (pRenderThread != nullptr)
+    {
+        sms->vdp.AttachRenderThread(nullptr);
+        delete pRenderThread;
+        pRenderThread = nullptr;
+    }
+
     //Free Additional Surface;
     SDL_DestroySurface(pOverlay);
 
+    //Destroy Screen Texture and Renderer
+    SDL_DestroyTexture(pScreenTexture);
+    SDL_DestroyRenderer(pRenderer);
+
     //Destroy window
     SDL_DestroyWindow(pWindow);
 
@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <array>
+#include <chrono>
 
 #include "z80a.h"
 #include "bios.h"
@@ -33,28 +34,111 @@ public:
 	std::shared_ptr<Bios> bios;					//Bios ROM - Always in Page 0, 0000h - 1fffh 
 	std::shared_ptr<Cartridge> cart;			//Cartridge ROM, 48K from 0000h - bfffh 							
 	std::array<uint8_t, 8 * 1024> ram;			//System 8K RAM (C000h - DFFFh, Mirrored at E000h - FFFFh)
-	uint64_t masterclock_cycles;
 	float frameDuration;
+	uint32_t nMapGeneration;					//Incremented whenever the Memory Map changes (Mapper or Memory Enables)
 	
 private:
 	bool bCartInserted;
 
+	//Catch-up Scheduler, VDP and PSG are clocked only when the CPU needs them
+	uint64_t vdp_sync_cycles;					//Master Clock timestamp of the next VDP clock
+	uint64_t vdp_event_cycles;					//Master Clock timestamp of the next VDP event
+	uint64_t psg_sync_cycles;					//Master Clock timestamp of the next PSG clock
+
+	//Master Clock timestamp of the CPU Instruction in execution
+	uint64_t GetMasterClock() { return cpu.GetCycleCounter() * 3; }
+
+	//Frameskip, skipped Frames are fully emulated but no pixel is drawn nor presented. Either
+	//nFrameSkip Frames are skipped after each rendered one, or with bAdaptiveSkip up to nFrameSkip
+	//in a row while the Host is late
+	uint8_t nFrameSkip;
+	bool bAdaptiveSkip;
+	uint8_t nSkipped;							//Frames skipped in a row
+	bool bFrameSkipped;							//The last Frame was skipped
+	std::chrono::steady_clock::time_point tpLastFrame;
+
+	bool SkipNextFrame();
+
+	void SyncVDP(uint64_t timestamp);
+	uint32_t GetVDPClocks(uint64_t timestamp);
+	void ScheduleVDPEvent();
+	void SyncPSG(uint64_t timestamp);
+
+	//Memory Page Table, host pointers to each 1K page of the CPU address space. Pages set
+	//to nullptr (unmapped or reacting to writes) go thru the slow path
+	std::array<uint8_t*, 64> pageRead;
+	std::array<uint8_t*, 64> pageWrite;
+
+	void UpdateMemoryMap();
+	uint8_t readMemSlow(uint16_t addr);
+	void writeMemSlow(uint16_t addr, uint8_t data);
+
 public:
 	//Read & Write from Memory (Emulate MREQ active low)
-	uint8_t readMem(uint16_t addr);
-	void writeMem(uint16_t addr, uint8_t data);
+	uint8_t readMem(uint16_t addr)
+	{
+		uint8_t* page = pageRead[addr >> 10];
+		return (page != nullptr) ? page[addr & 0x03ff] : readMemSlow(addr);
+	}
+
+	void writeMem(uint16_t addr, uint8_t data)
+	{
+		uint8_t* page = pageWrite[addr >> 10];
+		if (page != nullptr)
+			page[addr & 0x03ff] = data;
+		else
+			writeMemSlow(addr, data);
+	}
+
+	//Host pointers to addr for bulk transfers, nullptr if its page goes thru the slow path
+	uint8_t* GetReadPtr(uint16_t addr)
+	{
+		uint8_t* page = pageRead[addr >> 10];
+		return (page != nullptr) ? page + (addr & 0x03ff) : nullptr;
+	}
+
+	uint8_t* GetWritePtr(uint16_t addr)
+	{
+		uint8_t* page = pageWrite[addr >> 10];
+		return (page != nullptr) ? page + (addr & 0x03ff) : nullptr;
+	}
+
+	//Host pointer to addr if addr..addr+3 lies within one mapped page, nullptr otherwise
+	const uint8_t* GetFetchPtr(uint16_t addr)
+	{
+		uint8_t* page = pageRead[addr >> 10];
+		return (page != nullptr && (addr & 0x03ff) <= 0x03fc) ? page + (addr & 0x03ff) : nullptr;
+	}
 
 	//Read & Write from I/O Ports (Emulate IORQ active low)
 	uint8_t readIO(uint8_t addr);
 	void writeIO(uint8_t addr, uint8_t data);
 
+	//Idle Loop Detection, how an I/O Port read behaves when polled by an idle loop
+	enum IDLEPORT
+	{
+		IDLE_UNSAFE = 0,						//Side effects or changes at any time (H Counter, VDP Data)
+		IDLE_STABLE = 1,						//Doesn't change within a frame (Controllers, Memory Enables, unused Ports)
+		IDLE_VCOUNTER = 2,						//Changes on the VDP Status Generation, once per scanline
+		IDLE_STATUS = 3							//Changes on the VDP Status Generation, Sprite and VBlank Flags too
+	};
+
+	IDLEPORT GetIdlePort(uint8_t addr);
+	uint32_t GetIdleGeneration() const { return vdp.GetStatusGeneration(); }
+	uint64_t GetIdleCycleLimit(uint32_t generation, bool status);
+
+	//Translate a CPU Address to a Cartridge ROM Address, fails if not mapped to ROM
+	bool GetRomAddress(uint16_t addr, uint32_t& romaddr);
+	uint32_t GetMapGeneration() const { return nMapGeneration; }
+
 	bool SetRegion(ConsoleRegion region);
 	bool InsertCartridge();
 	bool RemoveCartridge();
 	bool NewFrame();
+	void SetFrameSkip(uint8_t frames, bool adaptive);
+	bool IsFrameSkipped() const { return bFrameSkipped; }
 	bool reset();
 	bool reset(uint16_t org);
-	bool clock();
 	float GetFrameDuration() const { return frameDuration; }
 };
 
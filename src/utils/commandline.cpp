@@ -1,4 +1,5 @@
 #include <loguru.hpp>
+#include <cstdlib>
 #include "commandline.h"
 
 bool commandline::parse(int argc, char* argv[])
@@ -15,6 +16,10 @@ bool commandline::parse(int argc, char* argv[])
         printf("              [--bin <bin filename>]\n");
         printf("              [--reg <Region: JP, US, EU>]\n");
 		printf("              [--map <Mapper: SEGA, CODEMASTER>]\n");
+        printf("              [--cpu <CPU Core: INTERP, BLOCK, DIFF, THREAD>]\n");
+        printf("              [--render <Video Renderer: SYNC, THREAD>]\n");
+        printf("              [--frameskip <Frames skipped: 0-9, AUTO>]\n");
+        printf("              [--bench <number of frames>]\n");
         return false;
     }
 
@@ -65,6 +70,58 @@ bool commandline::parse(int argc, char* argv[])
             return false;
         }
     }
+
+    if (r.checkCommand(argv, argv + argc, "--cpu"))
+    {
+        char* core = r.getStringValue(argv, argv + argc, "--cpu");
+        if (core != nullptr)
+        {
+            r.cpuCoreName = std::string(core);
+        }
+        else
+        {
+            printf("ERROR - Incorrect CPU Core parameter!\n");
+            return false;
+        }
+    }
+
+    if (r.checkCommand(argv, argv + argc, "--render"))
+    {
+        char* renderer = r.getStringValue(argv, argv + argc, "--render");
+        if (renderer != nullptr)
+        {
+            r.rendererName = std::string(renderer);
+        }
+        else
+        {
+            printf("ERROR - Incorrect Video Renderer parameter!\n");
+            return false;
+        }
+    }
+
+    if (r.checkCommand(argv, argv + argc, "--frameskip"))
+    {
+        char* frameskip = r.getStringValue(argv, argv + argc, "--frameskip");
+        if (frameskip != nullptr)
+        {
+            r.frameSkipName = std::string(frameskip);
+        }
+        else
+        {
+            printf("ERROR - Incorrect Frameskip parameter!\n");
+            return false;
+        }
+    }
+
+    if (r.checkCommand(argv, argv + argc, "--bench"))
+    {
+        r.benchFrames = r.getIntValue(argv, argv + argc, "--bench");
+        if (r.benchFrames <= 0)
+        {
+            printf("ERROR - Incorrect Benchmark frames parameter!\n");
+            return false;
+        }
+    }
     
     return true;
 }
@@ -87,6 +144,30 @@ std::string commandline::getMapper()
     return r.mapperName;
 }
 
+std::string commandline::getCpuCore()
+{
+    auto& r = instance();  // Singleton Alias
+    return r.cpuCoreName;
+}
+
+std::string commandline::getRenderer()
+{
+    auto& r = instance();  // Singleton Alias
+    return r.rendererName;
+}
+
+std::string commandline::getFrameSkip()
+{
+    auto& r = instance();  // Singleton Alias
+    return r.frameSkipName;
+}
+
+int commandline::getBenchFrames()
+{
+    auto& r = instance();  // Singleton Alias
+    return r.benchFrames;
+}
+
 //-----------------------------------------------------------------------------
 //
 // Private Helpers Methods
@@ -111,5 +192,12 @@ char* commandline::getStringValue(char** begin, char** end, const std::string& c
 
 int commandline::getIntValue(char** begin, char** end, const std::string& cmd)
 {
+    char* value = getStringValue(begin, end, cmd);
+
+    if (value != nullptr)
+    {
+        return std::atoi(value);
+    }
+
     return 0;
 }
@@ -16,6 +16,10 @@ public:
     static std::string getBinFileName();
     static std::string getRegion();
 	static std::string getMapper();
+	static std::string getCpuCore();
+	static std::string getRenderer();
+	static std::string getFrameSkip();
+	static int getBenchFrames();
 
 private:
     commandline() {}
@@ -28,4 +32,8 @@ private:
     std::string         binFilename;
     std::string         regionName;
     std::string         mapperName;
+    std::string         cpuCoreName;
+    std::string         rendererName;
+    std::string         frameSkipName;
+    int                 benchFrames = 0;
 };
\ No newline at end of file
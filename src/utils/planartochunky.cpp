@@ -0,0 +1,33 @@
+#include "planartochunky.h"
+
+//Build the table placing each bit of a byte in the low bit of its own byte lane
+static std::array<uint64_t, 256> BuildSpreadTable(bool hflip)
+{
+	std::array<uint64_t, 256> table;
+
+	for (int value = 0; value < 256; value++)
+	{
+		uint64_t lanes = 0;
+		for (int pixel = 0; pixel < 8; pixel++)
+		{
+			int bit = hflip ? pixel : 7 - pixel;
+			lanes |= (uint64_t)((value >> bit) & 0x01) << (pixel * 8);
+		}
+		table[value] = lanes;
+	}
+
+	return table;
+}
+
+const std::array<uint64_t, 256> PlanarToChunky::spread = BuildSpreadTable(false);
+const std::array<uint64_t, 256> PlanarToChunky::spreadFlip = BuildSpreadTable(true);
+
+void PlanarToChunky::Convert(const uint8_t* planes, uint8_t* pixels, bool hflip)
+{
+	const std::array<uint64_t, 256>& table = hflip ? spreadFlip : spread;
+
+	uint64_t lanes = table[planes[0]] | (table[planes[1]] << 1) | (table[planes[2]] << 2) | (table[planes[3]] << 3);
+
+	for (int pixel = 0; pixel < 8; pixel++)
+		pixels[pixel] = (uint8_t)(lanes >> (pixel * 8));
+}
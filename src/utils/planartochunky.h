@@ -0,0 +1,16 @@
+#pragma once
+#include <cstdint>
+#include <array>
+
+//Planar to Chunky Converter, turns the four Bitplane bytes of a Tile line into its eight Color
+//Indexes (leftmost pixel first, or rightmost when flipped Horizontally). Each plane byte is looked
+//up in a table that spreads its bits one per byte, the four results are merged with shifts and ors
+class PlanarToChunky
+{
+public:
+	static void Convert(const uint8_t* planes, uint8_t* pixels, bool hflip);
+
+private:
+	static const std::array<uint64_t, 256> spread;			//Bit 7 in byte 0 ... Bit 0 in byte 7
+	static const std::array<uint64_t, 256> spreadFlip;		//Bit 0 in byte 0 ... Bit 7 in byte 7
+};
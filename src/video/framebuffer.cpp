@@ -4,6 +4,7 @@ FrameBuffer::FrameBuffer()
 {
 	width = 0;
 	height = 0;
+	pitch = 0;
 
 	buffer = nullptr;
 }
@@ -11,45 +12,60 @@ FrameBuffer::FrameBuffer()
 FrameBuffer::FrameBuffer(int xRes, int yRes)
 {
 	if (buffer != nullptr)
-		delete[] buffer;
+		delete[] (uint32_t*)buffer;
 
 	width = xRes;
 	height = yRes;
+	pitch = xRes * sizeof(uint32_t);
 
-	buffer = new uint32_t[(xRes * yRes)];
+	buffer = (uint8_t*)new uint32_t[(xRes * yRes)];
+}
+
+//Frame Buffer drawing straight into the caller's memory, e.g. a locked streaming texture. The
+//pitch is the distance in bytes from a line to the next one, whatever the pixel size is
+FrameBuffer::FrameBuffer(void* pixels, int xRes, int yRes, int pitch)
+{
+	width = xRes;
+	height = yRes;
+	this->pitch = pitch;
+
+	buffer = (uint8_t*)pixels;
+	bOwnBuffer = false;
 }
 
 FrameBuffer::~FrameBuffer()
 {
-	if (buffer != nullptr)
-		delete[] buffer;
+	if (buffer != nullptr && bOwnBuffer)
+		delete[] (uint32_t*)buffer;
 }
 
 bool FrameBuffer::SetResolution(int xRes, int yRes)
 {
-	if (buffer != nullptr)
-		delete[] buffer;
+	if (buffer != nullptr && bOwnBuffer)
+		delete[] (uint32_t*)buffer;
 
 	width = xRes;
 	height = yRes;
+	pitch = xRes * sizeof(uint32_t);
 
-	buffer = new uint32_t[(xRes * yRes)];
+	buffer = (uint8_t*)new uint32_t[(xRes * yRes)];
+	bOwnBuffer = true;
 
 	return true;
 }
 
 bool FrameBuffer::SetPixel(int x, int y, int c)
 {
-	buffer[x + y * width] = c;
+	((uint32_t*)GetLine(y))[x] = c;
 	return false;
 }
 
 uint32_t FrameBuffer::GetPixel(int x, int y)
 {
-	return buffer[x + y * width];
+	return ((uint32_t*)GetLine(y))[x];
 }
 
 uint32_t* FrameBuffer::GetBuffer()
 {
-	return buffer;
+	return (uint32_t*)buffer;
 }
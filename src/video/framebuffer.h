@@ -6,6 +6,7 @@ class FrameBuffer
 public:
 	FrameBuffer();
 	FrameBuffer(int xRes, int yRes);
+	FrameBuffer(void* pixels, int xRes, int yRes, int pitch);
 	~FrameBuffer();
 
 public:
@@ -13,11 +14,16 @@ public:
 	bool SetPixel(int x, int y, int c);
 	uint32_t GetPixel(int x, int y);
 	uint32_t* GetBuffer();
+	uint8_t* GetLine(int y) { return buffer + y * pitch; }
+	int GetWidth() const { return width; }
+	int GetHeight() const { return height; }
 
 private:
 	int width;
 	int height;
+	int pitch;						//Bytes from a line to the next one
 
-	uint32_t* buffer = nullptr;
+	uint8_t* buffer = nullptr;
+	bool bOwnBuffer = true;			//false when drawing into the caller's memory
 };
 
@@ -0,0 +1,186 @@
+#include <algorithm>
+#include "linecompositor.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define LINECOMPOSITOR_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+//GCC and Clang need the SIMD instruction sets enabled per function, MSVC always allows them
+#if defined(__GNUC__) || defined(__clang__)
+#define TARGET_SSE41		__attribute__((target("sse4.1")))
+#define TARGET_AVX2			__attribute__((target("avx2")))
+#else
+#define TARGET_SSE41
+#define TARGET_AVX2
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//                      Scanline Compositors
+//
+////////////////////////////////////////////////////////////////////////////////
+static void ComposeScalar(uint8_t* dst, const uint8_t* bg, const uint8_t* priority, const uint8_t* spr)
+{
+	for (int x = 0; x < 256; x++)
+	{
+		if (bg[x] != 0 && priority[x] != 0)
+			dst[x] = bg[x];
+		else if (spr[x] != 0)
+			dst[x] = spr[x];
+		else if (bg[x] != 0)
+			dst[x] = bg[x];
+	}
+}
+
+#ifdef LINECOMPOSITOR_X86
+TARGET_SSE41 static void ComposeSSE41(uint8_t* dst, const uint8_t* bg, const uint8_t* priority, const uint8_t* spr)
+{
+	const __m128i zero = _mm_setzero_si128();
+
+	for (int x = 0; x < 256; x += 16)
+	{
+		__m128i d = _mm_loadu_si128((const __m128i*)(dst + x));
+		__m128i b = _mm_loadu_si128((const __m128i*)(bg + x));
+		__m128i p = _mm_loadu_si128((const __m128i*)(priority + x));
+		__m128i s = _mm_loadu_si128((const __m128i*)(spr + x));
+
+		//Transparent Background, Sprite and Low Priority masks
+		__m128i bgClear = _mm_cmpeq_epi8(b, zero);
+		__m128i sprClear = _mm_cmpeq_epi8(s, zero);
+		__m128i bgLow = _mm_cmpeq_epi8(p, zero);
+
+		//Opaque Background over the Backdrop, then opaque Sprites unless behind a Priority Tile
+		d = _mm_blendv_epi8(b, d, bgClear);
+		d = _mm_blendv_epi8(d, s, _mm_andnot_si128(sprClear, _mm_or_si128(bgClear, bgLow)));
+
+		_mm_storeu_si128((__m128i*)(dst + x), d);
+	}
+}
+
+TARGET_AVX2 static void ComposeAVX2(uint8_t* dst, const uint8_t* bg, const uint8_t* priority, const uint8_t* spr)
+{
+	const __m256i zero = _mm256_setzero_si256();
+
+	for (int x = 0; x < 256; x += 32)
+	{
+		__m256i d = _mm256_loadu_si256((const __m256i*)(dst + x));
+		__m256i b = _mm256_loadu_si256((const __m256i*)(bg + x));
+		__m256i p = _mm256_loadu_si256((const __m256i*)(priority + x));
+		__m256i s = _mm256_loadu_si256((const __m256i*)(spr + x));
+
+		//Transparent Background, Sprite and Low Priority masks
+		__m256i bgClear = _mm256_cmpeq_epi8(b, zero);
+		__m256i sprClear = _mm256_cmpeq_epi8(s, zero);
+		__m256i bgLow = _mm256_cmpeq_epi8(p, zero);
+
+		//Opaque Background over the Backdrop, then opaque Sprites unless behind a Priority Tile
+		d = _mm256_blendv_epi8(b, d, bgClear);
+		d = _mm256_blendv_epi8(d, s, _mm256_andnot_si256(sprClear, _mm256_or_si256(bgClear, bgLow)));
+
+		_mm256_storeu_si256((__m256i*)(dst + x), d);
+	}
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//                      Line Compositor Class Implementation
+//
+////////////////////////////////////////////////////////////////////////////////
+LineCompositor::LineCompositor()
+{
+	SetInstructionSet(DetectInstructionSet());
+}
+
+LineCompositor::~LineCompositor()
+{
+
+}
+
+//Select the Compositor for the given Instruction Set, it fails if the CPU doesn't support it
+bool LineCompositor::SetInstructionSet(INSTRUCTIONSET set)
+{
+	if (set > DetectInstructionSet())
+		return false;
+
+	switch (set)
+	{
+#ifdef LINECOMPOSITOR_X86
+	case AVX2: pCompose = ComposeAVX2; break;
+	case SSE41: pCompose = ComposeSSE41; break;
+#endif
+	default: pCompose = ComposeScalar; break;
+	}
+
+	nInstructionSet = set;
+
+	return true;
+}
+
+void LineCompositor::Compose(uint8_t* dst, const uint8_t* bg, const uint8_t* priority, const uint8_t* spr, bool bMaskColumn, uint8_t nMaskColor)
+{
+	pCompose(dst, bg, priority, spr);
+
+	//Blank the leftmost column with the Overscan Color
+	if (bMaskColumn)
+		std::fill_n(dst, 8, nMaskColor);
+}
+
+//Best Instruction Set supported by the CPU, AVX2 also needs the OS to save the YMM registers
+LineCompositor::INSTRUCTIONSET LineCompositor::DetectInstructionSet()
+{
+#ifdef LINECOMPOSITOR_X86
+	uint32_t eax = 0, ebx = 0, ecx = 0, edx = 0;
+	uint64_t xcr0 = 0;
+
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	uint32_t maxLeaf = info[0];
+	__cpuid(info, 1);
+	ecx = info[2];
+#else
+	uint32_t maxLeaf = __get_cpuid_max(0, nullptr);
+	__cpuid(1, eax, ebx, ecx, edx);
+#endif
+
+	bool sse41 = (ecx >> 19) & 0x01;
+	bool osxsave = (ecx >> 27) & 0x01;
+	bool avx = (ecx >> 28) & 0x01;
+
+	if (osxsave)
+	{
+#if defined(_MSC_VER)
+		xcr0 = _xgetbv(0);
+#else
+		__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		xcr0 = ((uint64_t)edx << 32) | eax;
+#endif
+	}
+
+	bool avx2 = false;
+	if (avx && ((xcr0 & 0x06) == 0x06) && maxLeaf >= 7)
+	{
+#if defined(_MSC_VER)
+		__cpuidex(info, 7, 0);
+		ebx = info[1];
+#else
+		__cpuid_count(7, 0, eax, ebx, ecx, edx);
+#endif
+		avx2 = (ebx >> 5) & 0x01;
+	}
+
+	if (avx2)
+		return AVX2;
+	if (sse41)
+		return SSE41;
+#endif
+
+	return SCALAR;
+}
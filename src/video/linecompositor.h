@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+
+//Merge the layers of a 256 pixels scanline of Color Indexes into the Indexed Colour Frame
+//
+// bg		Background Color Index, 0 for transparent pixels (Color #0)
+// priority	Background Priority flag, non zero if the Tile is drawn in front of Sprites
+// spr		Sprite Color Index, 0 for transparent pixels (Palette 1, Color #0)
+// dst		Backdrop on input, final scanline on output
+//
+//Opaque Background pixels with priority win over Sprites, opaque Sprites win over the other
+//Background pixels, the Backdrop shows thru where both are transparent. The SSE4.1 and AVX2
+//versions are selected at runtime thru CPUID, the scalar one is used everywhere else.
+class LineCompositor
+{
+public:
+	LineCompositor();
+	~LineCompositor();
+
+public:
+	enum INSTRUCTIONSET { SCALAR, SSE41, AVX2 };
+
+	bool SetInstructionSet(INSTRUCTIONSET set);
+	INSTRUCTIONSET GetInstructionSet() const { return nInstructionSet; }
+
+	void Compose(uint8_t* dst, const uint8_t* bg, const uint8_t* priority, const uint8_t* spr, bool bMaskColumn, uint8_t nMaskColor);
+
+private:
+	typedef void (*COMPOSEFUNC)(uint8_t* dst, const uint8_t* bg, const uint8_t* priority, const uint8_t* spr);
+
+	INSTRUCTIONSET nInstructionSet;
+	COMPOSEFUNC pCompose;
+
+	static INSTRUCTIONSET DetectInstructionSet();
+};
@@ -0,0 +1,118 @@
+#include <algorithm>
+#include "renderthread.h"
+
+RenderThread::RenderThread()
+{
+	worker = std::thread(&RenderThread::Run, this);
+}
+
+RenderThread::~RenderThread()
+{
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		bStop = true;
+	}
+	cv.notify_all();
+	worker.join();
+}
+
+//Queue a Frame for rendering, called by the VDP once its last scanline is logged. Blocks while
+//all the slots are in use
+void RenderThread::Submit(const RasterFrame& frame, const std::array<uint8_t, 16 * 1024>& vram, const std::array<bool, 512>& tiles)
+{
+	std::unique_lock<std::mutex> lock(mtx);
+
+	Slot* slot = nullptr;
+	cv.wait(lock, [&]()
+	{
+		auto it = std::find_if(slots.begin(), slots.end(), [](const Slot& s) { return s.state == FREE; });
+		slot = (it != slots.end()) ? &(*it) : nullptr;
+		return slot != nullptr;
+	});
+
+	//The slot is not used by the worker until it's queued
+	slot->frame = frame;
+	slot->vram = vram;
+	slot->tileDirty = tiles;
+	slot->nSequence = ++nSubmitted;
+	slot->state = QUEUED;
+
+	lock.unlock();
+	cv.notify_all();
+}
+
+//Newest rendered Frame not presented yet, or nullptr if there's none. Lines are 256 * 4 bytes apart
+//whatever the Host Pixel Format is. It must be released once copied to the screen
+const uint32_t* RenderThread::AcquireFrame()
+{
+	std::lock_guard<std::mutex> lock(mtx);
+
+	for (Slot& slot : slots)
+	{
+		if (slot.state == READY)
+		{
+			slot.state = PRESENTING;
+			return slot.screen.data();
+		}
+	}
+
+	return nullptr;
+}
+
+void RenderThread::ReleaseFrame()
+{
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		for (Slot& slot : slots)
+		{
+			if (slot.state == PRESENTING)
+				slot.state = FREE;
+		}
+	}
+	cv.notify_all();
+}
+
+//Worker thread, renders the queued Frames in submission order since each one only carries the
+//Tiles written after the previous one
+void RenderThread::Run()
+{
+	std::unique_lock<std::mutex> lock(mtx);
+
+	while (true)
+	{
+		Slot* slot = nullptr;
+		cv.wait(lock, [&]()
+		{
+			slot = nullptr;
+			for (Slot& s : slots)
+			{
+				if ((s.state == QUEUED) && ((slot == nullptr) || (s.nSequence < slot->nSequence)))
+					slot = &s;
+			}
+			return bStop || (slot != nullptr);
+		});
+
+		if (bStop)
+			break;
+
+		slot->state = RENDERING;
+		lock.unlock();
+
+		renderer.InvalidateTiles(slot->tileDirty);
+		renderer.RenderLines(slot->frame, slot->vram.data());
+		FrameBuffer target(slot->screen.data(), 256, 240, 256 * sizeof(uint32_t));
+		renderer.ConvertFrame(slot->frame, target);
+
+		lock.lock();
+
+		//Only the newest rendered Frame is kept for presentation
+		for (Slot& s : slots)
+		{
+			if (s.state == READY)
+				s.state = FREE;
+		}
+		slot->state = READY;
+
+		cv.notify_all();
+	}
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstdint>
+#include <array>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include "scanlinerenderer.h"
+
+//Render Thread, renders the Frames handed over by the VDP and converts them to the Host Pixel Format
+//while the CPU emulates the next Frame. Frames go thru three slots (triple buffering): one queued or
+//being rendered, the newest completed one and the one being presented. The VDP waits for a free slot,
+//older completed Frames are dropped when a newer one is ready.
+class RenderThread
+{
+public:
+	RenderThread();
+	~RenderThread();
+
+public:
+	void Submit(const RasterFrame& frame, const std::array<uint8_t, 16 * 1024>& vram, const std::array<bool, 512>& tiles);
+	const uint32_t* AcquireFrame();
+	void ReleaseFrame();
+
+private:
+	enum SLOTSTATE { FREE, QUEUED, RENDERING, READY, PRESENTING };
+
+	struct Slot
+	{
+		SLOTSTATE state = FREE;
+		uint64_t nSequence = 0;								//Submission order
+		RasterFrame frame;
+		std::array<uint8_t, 16 * 1024> vram;				//VRAM image of the Frame
+		std::array<bool, 512> tileDirty;					//Tiles written since the previous Frame
+		std::array<uint32_t, 256 * 240> screen;				//Rendered Frame, 256 * 4 bytes per line
+	};
+
+	std::array<Slot, 3> slots;
+	uint64_t nSubmitted = 0;
+	bool bStop = false;
+
+	std::mutex mtx;
+	std::condition_variable cv;
+	std::thread worker;
+
+	ScanlineRenderer renderer;						//Only used by the worker thread
+
+	void Run();
+};
@@ -0,0 +1,304 @@
+#include <algorithm>
+#include "scanlinerenderer.h"
+
+ScanlineRenderer::ScanlineRenderer()
+{
+	//All Tiles must be decoded on first use
+	tileDirty.fill(true);
+}
+
+ScanlineRenderer::~ScanlineRenderer()
+{
+
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+//                      Frame Rendering & Conversion
+//
+////////////////////////////////////////////////////////////////////////////////
+//Mark the given Tiles dirty, they're decoded again from VRAM on next use
+void ScanlineRenderer::InvalidateTiles(const std::array<bool, 512>& tiles)
+{
+	for (int i = 0; i < 512; i++)
+		tileDirty[i] = tileDirty[i] || tiles[i];
+}
+
+//Render the logged scanlines of the Frame not rendered yet. Returns true if any was rendered
+bool ScanlineRenderer::RenderLines(RasterFrame& frame, const uint8_t* pVram)
+{
+	if (frame.nRenderedLines >= frame.nLoggedLines)
+		return false;
+
+	vram = pVram;
+	for (; frame.nRenderedLines < frame.nLoggedLines; frame.nRenderedLines++)
+		RenderScanline(frame, frame.nRenderedLines);
+
+	return true;
+}
+
+//Convert the Indexed Colour Frame into the target Frame Buffer thru the Host Palette snapshot of each
+//scanline, the Colors are already in the Host Pixel Format
+template <typename PIXEL>
+static void ConvertLines(const RasterFrame& frame, FrameBuffer& target, int height)
+{
+	for (int y = 0; y < height; y++)
+	{
+		const uint32_t* palette = frame.linePalette[y].data();
+		const uint8_t* src = &frame.indexBuffer[y * 256];
+		PIXEL* dst = (PIXEL*)target.GetLine(y);
+		for (int x = 0; x < 256; x++)
+			dst[x] = (PIXEL)palette[src[x] & 0x1f];
+	}
+}
+
+void ScanlineRenderer::ConvertFrame(const RasterFrame& frame, FrameBuffer& target)
+{
+	int height = std::min(target.GetHeight(), 240);
+
+	if (frame.nPixelSize == 2)
+		ConvertLines<uint16_t>(frame, target, height);
+	else
+		ConvertLines<uint32_t>(frame, target, height);
+}
+
+//Convert the Indexed Colour Frame into an ARGB8888 Frame Buffer thru the CRAM snapshot of each
+//scanline, whatever the Host Pixel Format is. The palette holds the 64 SMS Colors in ARGB8888
+void ScanlineRenderer::ConvertFrameARGB(const RasterFrame& frame, FrameBuffer& target, const uint32_t* palette)
+{
+	int height = std::min(target.GetHeight(), 240);
+	std::array<uint32_t, 32> linePalette;
+
+	for (int y = 0; y < height; y++)
+	{
+		for (int i = 0; i < 32; i++)
+			linePalette[i] = palette[frame.lineCram[y][i] & 0x3f];
+
+		const uint8_t* src = &frame.indexBuffer[y * 256];
+		uint32_t* dst = (uint32_t*)target.GetLine(y);
+		for (int x = 0; x < 256; x++)
+			dst[x] = linePalette[src[x] & 0x1f];
+	}
+}
+
+//Render a logged scanline
+bool ScanlineRenderer::RenderScanline(RasterFrame& frame, uint16_t line)
+{
+	const RasterLine& ls = frame.lineLog[line];
+
+	//Nothing but the Backdrop if the Video is disabled
+	if (!ls.bDisplay)
+		return true;
+
+	//Render the Background and Sprite layers of the scanline
+	(this->*bgRenderers[((ls.reg0 >> 6) & 0x01) | ((ls.reg0 >> 6) & 0x02) | ((ls.row_number == 32) << 2)])(line, ls);
+	RenderSprites(line, ls);
+
+	//Merge the layers over the Backdrop, Priority Tiles over Sprites over the other Tiles, and
+	//mask Column one if Reg0 - Bit5 is enabled
+	compositor.Compose(&frame.indexBuffer[line * 256], bgLine.data(), bgPriority.data(), sprLine.data(), (ls.reg0 >> 5) & 0x01, 16 + (ls.reg7 & 0x0f));
+
+	return true;
+}
+
+//Decode all 8 lines of a Tile into the Tile Cache, plain and flipped Horizontally
+void ScanlineRenderer::DecodeTile(uint16_t tile)
+{
+	for (uint8_t line = 0; line < 8; line++)
+	{
+		const uint8_t* planes = &vram[tile * 32 + line * 4];
+
+		PlanarToChunky::Convert(planes, &tileCache[tile * 64 + line * 8], false);
+		PlanarToChunky::Convert(planes, &tileCacheFlip[tile * 64 + line * 8], true);
+	}
+
+	tileDirty[tile] = false;
+}
+
+//Get the 8 Color Indexes of a Tile line from the Tile Cache, decoding the Tile if its VRAM changed
+const uint8_t* ScanlineRenderer::GetTileLine(uint16_t tile, uint8_t line, bool hflip)
+{
+	tile &= 0x1ff;
+
+	if (tileDirty[tile])
+		DecodeTile(tile);
+
+	return (hflip ? &tileCacheFlip[0] : &tileCache[0]) + tile * 64 + line * 8;
+}
+
+//Background Line Renderers, one per combination of Reg0 Horizontal and Vertical Scroll Inhibit
+//and Name Table Rows (28 rows for 192 lines, 32 for 224 and 240 lines). Selected once per scanline
+const std::array<ScanlineRenderer::BGRENDERFUNC, 8> ScanlineRenderer::bgRenderers =
+{
+	&ScanlineRenderer::RenderBackground<false, false, 28>,
+	&ScanlineRenderer::RenderBackground<true, false, 28>,
+	&ScanlineRenderer::RenderBackground<false, true, 28>,
+	&ScanlineRenderer::RenderBackground<true, true, 28>,
+	&ScanlineRenderer::RenderBackground<false, false, 32>,
+	&ScanlineRenderer::RenderBackground<true, false, 32>,
+	&ScanlineRenderer::RenderBackground<false, true, 32>,
+	&ScanlineRenderer::RenderBackground<true, true, 32>,
+};
+
+template <bool HSI, bool VSI, uint8_t ROWS>
+bool ScanlineRenderer::RenderBackground(uint16_t line, const RasterLine& ls)
+{
+	NameTableEntry elem;
+
+	//Horizontal Scrolling Disabled for Row 0-1 if Reg0 HSI is set, else set by Reg8
+	bool hscroll = !(HSI && (line < 16));
+	uint8_t hscroll_col = hscroll ? 0x20 - (ls.reg8 >> 3) : 0;
+	uint8_t hscroll_fine = hscroll ? ls.reg8 & 0x07 : 0;
+
+	//Name Table Row and Tile Line scrolled Vertically by Reg9, or fixed for Columns 24 - 31
+	//if Reg0 VSI is set
+	uint8_t scrolled_row = ((line + ls.reg9) >> 3) % ROWS;
+	uint8_t scrolled_line = (line + ls.reg9) & 0x07;
+	uint8_t fixed_row = line >> 3;
+	uint8_t fixed_line = line & 0x07;
+
+	//Go thru all 32 column
+	for (uint8_t col = 0; col < 32; col++)
+	{
+		bool vscroll = !(VSI && (col >= 24));
+		uint8_t row = vscroll ? scrolled_row : fixed_row;
+		uint8_t tile_line = vscroll ? scrolled_line : fixed_line;
+
+		//Read Name Table Entry for current Tile (2 Byte), each Name Table Entry is 2 Byte per Tile
+		uint16_t nameTableOffset = ls.nameTabAddr + ((col + hscroll_col) & 0x1f) * 2 + row * 64;
+		elem.lsb = vram[nameTableOffset];
+		elem.msb = vram[nameTableOffset + 1];
+
+		//Get the Tile Line from the Tile Cache, swapped Horizontally and/or Vertically
+		//according to Name Table Entry flags
+		const uint8_t* tileLine = GetTileLine(elem.char_id, elem.vflip ? 7 - tile_line : tile_line, elem.hflip);
+		uint8_t palette = elem.palette * 16;
+		uint8_t priority = elem.priority;
+
+		//Render a full line (8 pixel) of the current Tile, both priorities go in the Background layer.
+		//Color 0 is always transparent, pixels scrolled past the right border wrap around
+		for (int j = 0; j < 8; j++)
+		{
+			uint8_t x = col * 8 + j + hscroll_fine;
+			uint8_t color = tileLine[j];
+
+			bgLine[x] = (color != 0x00) ? palette + color : 0;
+			bgPriority[x] = priority;
+		}
+	}
+
+	return true;
+}
+
+//Position of a Sprite on the scanline: its leftmost pixel and the Tile and Tile line it shows
+void ScanlineRenderer::GetSpriteLine(uint16_t line, const RasterLine& ls, uint8_t sprite, int& x, uint16_t& tile, uint8_t& tileLine)
+{
+	//Extract Current Sprite Attributes from Attribute Table
+	uint8_t sprY = vram[ls.sprAttrTabAddr + sprite] + 1;
+	uint8_t sprX = vram[ls.sprAttrTabAddr + 0x80 + sprite * 2];
+	uint16_t sprID = vram[ls.sprAttrTabAddr + 0x80 + sprite * 2 + 1];
+
+	//Update sprID according to Reg6 Setting, it select beetwen first 256 tile and second 256 Tiles
+	if (((ls.reg6 >> 2) & 0x01) == 1)
+	{
+		sprID += 256;
+	}
+
+	//Get the current Sprite Line, 8x16 Sprites continue on the next Tile
+	uint8_t sprLineOffset;
+
+	if (sprY >= ls.active_period)
+	{
+		sprLineOffset = line - (sprY - 256);
+	}
+	else
+	{
+		sprLineOffset = line - sprY;
+	}
+
+	x = sprX - 8 * ((ls.reg0 >> 3) & 0x01);
+	tile = (sprID + (sprLineOffset >> 3)) & 0x1ff;
+	tileLine = sprLineOffset & 0x07;
+}
+
+bool ScanlineRenderer::RenderSprites(uint16_t line, const RasterLine& ls)
+{
+	sprLine.fill(0);
+
+	//if Sprite Buffer is not Empty Draw Sprite on this Scanline
+	if (ls.sprCounter != 0)
+	{
+		for (uint8_t i = 0; i < ls.sprCounter; i++)
+		{
+			int sprX;
+			uint16_t tile;
+			uint8_t tileLine;
+			GetSpriteLine(line, ls, ls.sprBuffer[i], sprX, tile, tileLine);
+
+			const uint8_t* sprTileLine = GetTileLine(tile, tileLine, false);
+
+			//Render Sprite Line
+			for (uint8_t k = 0; k < 8; k++)
+			{
+				uint8_t color = sprTileLine[k];
+
+				//Don't draw pixel if color is transparent (Palette 1, Color #0) or off screen
+				int x = sprX + k;
+				if ((color != 0x00) && (x >= 0) && (x < 256))
+				{
+					sprLine[x] = 16 + color;
+				}
+			}
+		}
+	}
+	
+	return true;
+}
+
+//Check the Sprites of a logged scanline for overlapping opaque pixels. Each Sprite line becomes a
+//256 bit mask of its opaque pixels (bit 255 - x for pixel x), a pixel is opaque if any of its Tile
+//planes is set so the Tiles aren't decoded. Sprites collide if their mask hits the ones before
+bool ScanlineRenderer::SpriteCollision(uint16_t line, const RasterLine& ls, const uint8_t* pVram)
+{
+	std::array<uint64_t, 4> lineMask = {};
+
+	vram = pVram;
+	for (uint8_t i = 0; i < ls.sprCounter; i++)
+	{
+		int sprX;
+		uint16_t tile;
+		uint8_t tileLine;
+		GetSpriteLine(line, ls, ls.sprBuffer[i], sprX, tile, tileLine);
+
+		const uint8_t* planes = &vram[tile * 32 + tileLine * 4];
+		uint64_t opaque = planes[0] | planes[1] | planes[2] | planes[3];
+
+		//Move the 8 pixels to their place, the ones past the right border are dropped
+		int shift = 248 - sprX;
+		if (shift < 0)
+		{
+			opaque >>= -shift;
+			shift = 0;
+		}
+
+		std::array<uint64_t, 4> sprMask = {};
+		int lane = shift >> 6;
+		if (lane < 4)
+			sprMask[lane] = opaque << (shift & 63);
+		if (((shift & 63) > 56) && (lane < 3))
+			sprMask[lane + 1] = opaque >> (64 - (shift & 63));
+
+		//Overlap with the pixels drawn so far, the lanes are independent and vectorize
+		uint64_t hit = 0;
+		for (int l = 0; l < 4; l++)
+		{
+			hit |= lineMask[l] & sprMask[l];
+			lineMask[l] |= sprMask[l];
+		}
+
+		if (hit != 0)
+			return true;
+	}
+
+	return false;
+}
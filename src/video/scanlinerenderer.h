@@ -0,0 +1,94 @@
+#pragma once
+#include <cstdint>
+#include <array>
+#include "planartochunky.h"
+#include "linecompositor.h"
+#include "framebuffer.h"
+
+#define MAXSPRITEPERLINE	8
+
+union NameTableEntry {
+	struct { uint8_t lsb, msb; };
+	uint16_t w;
+	struct {
+		uint16_t char_id : 9;
+		uint16_t hflip : 1;
+		uint16_t vflip : 1;
+		uint16_t palette : 1;
+		uint16_t priority : 1;
+		uint16_t : 3;
+	};
+};
+
+//Raster Register Log entry, the registers and Sprites of a scanline as they were on its last
+//visible dot
+struct RasterLine
+{
+	uint8_t reg0, reg6, reg7, reg8, reg9;
+	uint16_t nameTabAddr;
+	uint16_t sprAttrTabAddr;
+	uint16_t active_period;
+	uint8_t row_number;
+	bool bDisplay;											//Reg1 Video Enable
+	uint8_t sprCounter;										//Number of Sprite on the Sprite Buffer
+	std::array<uint8_t, MAXSPRITEPERLINE> sprBuffer;		//Sprites on the scanline in SAT order
+};
+
+//Indexed Colour Frame, one CRAM index (palette * 16 + color) per pixel, with the Raster Register Log
+//and the Host Palette snapshot of each scanline. Logged scanlines are rendered later, a batch at a time
+struct RasterFrame
+{
+	std::array<uint8_t, 256 * 240> indexBuffer;
+	std::array<RasterLine, 240> lineLog;
+	std::array<std::array<uint32_t, 32>, 240> linePalette;	//Host Palette snapshot of each scanline
+	std::array<std::array<uint8_t, 32>, 240> lineCram;	//CRAM snapshot of each scanline
+	std::array<uint32_t, 240> lineCramGeneration;		//CRAM Generation of each snapshot
+	uint8_t nPixelSize;									//Bytes per pixel of the Host Palette Colors (2 or 4)
+	uint16_t nLoggedLines;								//Scanlines logged in the current Frame
+	uint16_t nRenderedLines;							//Logged scanlines already rendered
+};
+
+//Renders the logged scanlines of a Raster Frame from a VRAM image and converts the Frame to the
+//Host Pixel Format.
+//Each renderer keeps its own Tile Cache, so one can run on another thread than the VDP
+class ScanlineRenderer
+{
+public:
+	ScanlineRenderer();
+	~ScanlineRenderer();
+
+public:
+	void InvalidateTile(uint16_t tile) { tileDirty[tile & 0x1ff] = true; }
+	void InvalidateTiles(const std::array<bool, 512>& tiles);
+	bool RenderLines(RasterFrame& frame, const uint8_t* pVram);
+	void ConvertFrame(const RasterFrame& frame, FrameBuffer& target);
+	void ConvertFrameARGB(const RasterFrame& frame, FrameBuffer& target, const uint32_t* palette);
+	bool SpriteCollision(uint16_t line, const RasterLine& ls, const uint8_t* pVram);
+
+private:
+	const uint8_t* vram = nullptr;					//VRAM image the scanlines are rendered from
+
+	//Decoded Tile Cache, all the 512 Tiles in VRAM with one byte of Color Index per pixel, plain and
+	//flipped Horizontally. Tiles are marked dirty on VRAM writes and decoded again when rendered
+	std::array<uint8_t, 512 * 64> tileCache;
+	std::array<uint8_t, 512 * 64> tileCacheFlip;
+	std::array<bool, 512> tileDirty;
+
+	//Layers of the current scanline, merged into the Indexed Colour Frame by the Line Compositor
+	std::array<uint8_t, 256> bgLine;				//Background Color Index, 0 if transparent
+	std::array<uint8_t, 256> bgPriority;			//Background Tile Priority flag
+	std::array<uint8_t, 256> sprLine;				//Sprite Color Index, 0 if transparent
+	LineCompositor compositor;
+
+	typedef bool (ScanlineRenderer::*BGRENDERFUNC)(uint16_t line, const RasterLine& ls);
+	static const std::array<BGRENDERFUNC, 8> bgRenderers;
+
+	const uint8_t* GetTileLine(uint16_t tile, uint8_t line, bool hflip);
+	void DecodeTile(uint16_t tile);
+
+	bool RenderScanline(RasterFrame& frame, uint16_t line);
+	template <bool HSI, bool VSI, uint8_t ROWS>
+	bool RenderBackground(uint16_t line, const RasterLine& ls);
+	bool RenderSprites(uint16_t line, const RasterLine& ls);
+	void GetSpriteLine(uint16_t line, const RasterLine& ls, uint8_t sprite, int& x, uint16_t& tile, uint8_t& tileLine);
+};
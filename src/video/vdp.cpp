@@ -1,7 +1,7 @@
+#include <algorithm>
 #include "vdp.h"
+#include "renderthread.h"
 #include "sms.h"
-
-
 VDP::VDP()
 {
 	//Init Internal Status
@@ -22,14 +22,23 @@ VDP::VDP()
 	reg8 = 0x00;		//Background X Scroll
 	reg9 = 0x00;		//Background Y Scroll
 	reg10 = 0xff;		//Line Counter for Line Interrupt
-
 	status.b = 0x00;		//Status Register
-
+	nStatusGeneration = 0;
 	//Init Control Port & Data Port Variables 
 	command_word = 0;
 	code_reg = 0;
 	addr_reg = 0;
 	read_buf = 0x00;
+
+	//Sprites must be evaluated on first use
+	bSpriteCacheDirty = true;
+
+	//No scanline logged yet, the Render Thread has no Tile decoded
+	frame.nLoggedLines = 0;
+	frame.nRenderedLines = 0;
+	tileWritten.fill(true);
+	pRenderThread = nullptr;
+	bSkipFrame = false;
 		
 	bFrameComplete = false;
 	bFirstByteRecv = false;
@@ -38,19 +47,45 @@ VDP::VDP()
 	active_period = 192;
 	additional_scan = 0;
 
-	pRenderBuffer = nullptr;
-	pFrameBuffer = nullptr;
-	pCharTable[0] = nullptr;
-	pCharTable[1] = nullptr;
+	//NTSC Timings until the Video Standard is set
+	video_std = NTSC;
+	scanline_lenght = 342;
+	scanline_number = 262;
+	UpdateCounterTable();
 
-	//Autogenerate all 64 Color Palette Scaling RGB from 2bit to 8bit
-	//Color Value Stored in CRAM is used as an Index for the Palette.
-	//Note that in CRAM color are stores as 8 bit 00bbggrr
-	//TODO - Need to be checked for Color accuracy
-	for (uint8_t c = 0; c < 64; c++)
+	//First dot from each HCount value on that needs RunEvent()
+	for (uint16_t h = 0; h <= 342; h++)
 	{
-		palScreen[c] = _rgba_to_int(((c >> 0) & 0x03) * 0x55, ((c >> 2) & 0x03) * 0x55, ((c >> 4) & 0x03) * 0x55, 0xff);
+		nextEventDot[h] = 342;
+		for (uint16_t dot : { (uint16_t)341, (uint16_t)304, (uint16_t)303, (uint16_t)0xff, (uint16_t)0 })
+		{
+			if (dot >= h)
+				nextEventDot[h] = dot;
+		}
 	}
+
+	//Buffers are allocated once, the same size for every Video Standard
+	pRenderBuffer = nullptr;
+	pFrameBuffer = new FrameBuffer(256, 240);
+	pCharTable[0] = new FrameBuffer(128, 128);
+	pCharTable[1] = new FrameBuffer(128, 128);
+
+	//Character Tables are drawn on first use
+	charTileDirty.fill(true);
+	charTablePalette.fill(0xff);
+	charTableCramGeneration.fill(0);
+
+	//No scanline has a Palette snapshot yet
+	frame.indexBuffer.fill(0);
+	frame.lineCramGeneration.fill(0xffffffff);
+	for (auto& line : frame.lineCram)
+		line.fill(0);
+	nCramGeneration = 0;
+	bFrameConverted = false;
+
+	//Host Palette in ARGB until the presentation surface asks for another format
+	cram.fill(0);
+	SetPixelFormat(ARGB8888);
 }
 
 VDP::~VDP()
@@ -67,12 +102,6 @@ VDP::~VDP()
 //                        Helper Functions
 //
 ////////////////////////////////////////////////////////////////////////////////
-//Swap bits in a unsigned char, used with Horizontal Mirroring 
-inline uint8_t VDP::_bitswap_uint8(uint8_t x)
-{
-	return (x * 0x0202020202ULL & 0x010884422010ULL) % 1023;
-}
-
 inline uint32_t VDP::_rgba_to_int(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
 {
 	uint32_t color = 0;
@@ -89,47 +118,14 @@ inline uint32_t VDP::_rgba_to_int(uint8_t r, uint8_t g, uint8_t b, uint8_t a)
 ////////////////////////////////////////////////////////////////////////////////
 bool VDP::read(uint8_t addr, uint8_t& data)
 {
-	//Get VCount according to Video Mode and Resolution 
-	auto getVCountByte = [&]()
-	{
-		uint8_t delta = scanline_number - 256U;
-
-		if (video_std == 0)
-		{
-			if (active_period == 192)
-				return (VCount > 0xf2) ? (uint8_t)(VCount - delta) : (uint8_t)VCount;
-			if (active_period == 224)
-				return (VCount > 0x102) ? (uint8_t)(VCount - delta) : (uint8_t)VCount;
-			if (active_period == 240)
-				return (VCount > 0x10a) ? (uint8_t)(VCount - delta) : (uint8_t)VCount;
-		}
-
-		if (video_std == 1)
-		{
-			if (active_period == 192)
-				return (VCount > 0xda) ? (uint8_t)(VCount - delta) : (uint8_t)VCount;
-			if (active_period == 224)
-				return (VCount > 0xea) ? (uint8_t)(VCount - delta) : (uint8_t)VCount;
-		}
-
-		return (uint8_t)0;
-	};
-
-	//Get HCount from counter
-	auto getHCountByte = [&]()
-	{
-		//return (HCount <= 0xff) ? (uint8_t)HCount : 0xff;
-		return (HCount & 0x1fe) >> 1;
-	};
-
 	switch (addr)
 	{
 	case 0x40:
-		data = getVCountByte();;
+		data = GetVCounter(0);
 		break;
 
 	case 0x41:
-		data = getHCountByte();
+		data = GetHCounter(0);
 		break;
 
 	case 0x80:
@@ -181,6 +177,7 @@ bool VDP::reset()
 	reg10 = 0xff;		//Line Counter for Line Interrupt
 
 	status.b = 0x00;		//Status Register
+	nStatusGeneration = 0;
 
 	//Init Control Port & Data Port Variables 
 	command_word = 0;
@@ -193,132 +190,251 @@ bool VDP::reset()
 
 	raster_counter = 0;
 	active_period = 192;
+	UpdateCounterTable();
+
+	//Registers changed, Sprites must be evaluated again
+	bSpriteCacheDirty = true;
+
+	//Drop the scanlines logged in the current Frame
+	frame.nLoggedLines = 0;
+	frame.nRenderedLines = 0;
 
 	return true;
 }
 
-bool VDP::clock()
+//Run the dot at HCount, one of the dots where the VDP does more than drawing the Backdrop:
+//scanline log at HCount 255, Line Counter decrement at the first dot of the scanline, VBlank at
+//303, Interrupts at 304, Line Counter reload on the last dot and the scanline change
+bool VDP::RunEvent()
 {
-	//Check whenever tha Raster Counter expire and Throw a Line Interrupt
-	//Raster Counter is loaded with Reg10 outside Active Area or when
-	//it's value underflow to 0xff. 
-	auto checkRasterCounter = [&]()
+	//HCount & VCount Loop
+	//Each Scanline is 342 pixel long counting from 0..341
+	if (HCount == scanline_lenght)
 	{
-		if (VCount <= active_period)
-		{
-			//Decrement raster_counter at the begining of the scanline
-			if (HCount == 0)
-			{
-				raster_counter--;
-			}
-
-			if (raster_counter == 0xff)
-			{
-				if (HCount == scanline_lenght - 1)
-				{
-					raster_counter = reg10;
-				}
-
-				return true;
-			}
-		}
-		else
+		HCount = 0;
+
+		VCount++;
+		nStatusGeneration++;
+		if (VCount == scanline_number)
 		{
-			raster_counter = reg10;
+			//Render the scanlines logged after the Frame was rendered (the Video Mode changed)
+			if (frame.nRenderedLines < frame.nLoggedLines)
+				RenderFrame();
+			frame.nLoggedLines = 0;
+			frame.nRenderedLines = 0;
+
+			//Start a New Frame
+			bFrameComplete = true;
+			VCount = 0;
+			nFrameCounter++;
 		}
-		return false;
-	};
-		
-	//Assert CPU Maskable Interrupt INT if Line Interrupt is enabled  
-	auto assertLineIrq = [&]()
+	}
+
+	if ((HCount < 256) & (VCount < GetRenderedLines()))
 	{
-		if (reg0.ie1 == 1)
-			sms->cpu.irq();
+		//Reset Backgroung to Reg7 Color, after the Loop so the last dot of a scanline draws
+		//the first dot of the next one
+		if (!bSkipFrame)
+			SetPixelIndex(HCount, VCount, 16 + (reg7 & 0x0f));
+
+		//Log the scanline on its last visible dot, it's rendered later as a whole with the
+		//other scanlines of the Frame. Skipped Frames are logged too, for the Sprite flags
+		if (HCount == 0xff)
+		{
+			if (!bSkipFrame)
+				SnapshotCram();
+			LogScanline();
 
-		return true;
-	};
+			//The Frame can be rendered once its last scanline is logged
+			if (VCount == GetRenderedLines() - 1)
+				RenderFrame();
+		}
+	}
 
-	//Assert CPU Maskable Interrupt INT if Frame Interrupt is enabled
-	auto assertFrameIrq = [&]()
-	{
-		if (reg1.ie0 == 1)
-			sms->cpu.irq();
-						
-		return true;
-	};
-	
-	//Render the screen if Blank enabled else Blank the video
-	if (reg1.blk)
+	//Exiting Active Area of the Screen, set VBlank Status Flag then assert the Frame IRQ
+	if (VCount == active_period)
 	{
-		if ((HCount < 256) & (VCount < (active_period + additional_scan)))
+		if (HCount == 303)
 		{
-			//Reset Backgroung to Reg7 Color
-			pFrameBuffer->SetPixel(HCount, VCount, GetColorFromCRam(reg7 & 0x0f, 1));
+			status.vblank = 1;
+			nStatusGeneration++;
+		}
 
-			//Render Background Priority 0 Tiles
-			RenderBackground(0);
+		if ((HCount == 304) && (reg1.ie0 == 1))
+			sms->cpu.irq();
+	}
 
-			//Render Sprites
-			RenderSprites();
+	//Raster Counter is decremented at the begining of the scanlines within the Active Area, on
+	//underflow to 0xff the Line IRQ is asserted and it's reloaded with Reg10 at the end of the
+	//scanline. Outside the Active Area it's reloaded on every dot
+	if (VCount <= active_period)
+	{
+		if (HCount == 0)
+			raster_counter--;
 
-			//Render Background Priority 1 Tiles
-			RenderBackground(1);
+		if (raster_counter == 0xff)
+		{
+			if ((HCount == 304) && (reg0.ie1 == 1))
+				sms->cpu.irq();
 
-			//Mask Column one if Reg0 - Bit5 is enabled
-			MaskColumnOne();
+			if (HCount == scanline_lenght - 1)
+				raster_counter = reg10;
 		}
 	}
 	else
 	{
-		if ((HCount < 256) & (VCount < (active_period + additional_scan)))
-		{
-			pFrameBuffer->SetPixel(HCount, VCount, GetColorFromCRam(reg7 & 0x0f, 1));
-		}
+		raster_counter = reg10;
 	}
-	
-	//HCount & VCount Loop
-	//Each Scanline is 342 pixel long counting from 0..341
-	//While going to the screen assert IRQ if necessary
 
-	//Increment Vertical Counter
-	if (HCount == scanline_lenght)
+	//Increment Horizontal Counter
+	HCount++;
+	nCycleCounter++;
+
+	return true;
+}
+
+//Run the VDP for the given number of clocks. The VDP is never clocked a dot at a time: it
+//jumps from one event dot to the next (see RunEvent()), drawing the Backdrop of the dots in
+//between in bulk
+bool VDP::run(uint32_t clocks)
+{
+	while (clocks > 0)
 	{
-		HCount = 0;
+		if (HCount == nextEventDot[HCount])
+		{
+			RunEvent();
+			clocks--;
+			continue;
+		}
 
-		VCount++;
-		if (VCount == scanline_number)
+		uint32_t n = std::min<uint32_t>(clocks, nextEventDot[HCount] - HCount);
+
+		//Reset Background to Reg7 Color
+		if ((HCount < 256) && (VCount < GetRenderedLines()) && !bSkipFrame)
 		{
-			//Start a New Frame
-			bFrameComplete = true;
-			VCount = 0;
-			nFrameCounter++;
+			std::fill_n(&frame.indexBuffer[VCount * 256 + HCount], std::min<uint32_t>(n, 256 - HCount), 16 + (reg7 & 0x0f));
+			bFrameConverted = false;
 		}
+
+		//Outside the Active Area the Line Counter is reloaded on every dot
+		if (VCount > active_period)
+			raster_counter = reg10;
+
+		HCount += n;
+		nCycleCounter += n;
+		clocks -= n;
 	}
 
-	//Exiting Active Area of the Screen
-	if (VCount == active_period)
+	return true;
+}
+
+//Skip drawing the pixels of the next Frame. Its first dots are run at the end of the previous
+//Frame, they're drawn again when a skipped Frame is followed by a drawn one
+void VDP::SetSkipFrame(bool skip)
+{
+	if (bSkipFrame && !skip && (VCount == 0))
 	{
-		//Set VBlank Status Flag
-		if (HCount == 303)
-			status.vblank = 1;
+		std::fill_n(frame.indexBuffer.begin(), std::min<uint16_t>(HCount, 256), 16 + (reg7 & 0x0f));
+		bFrameConverted = false;
+	}
 
-		//Assert Frame IRQ
-		if (HCount == 304)
-			assertFrameIrq();
+	bSkipFrame = skip;
+}
+
+//Number of clocks to run, the last one included, to reach the next point where the VDP
+//changes the CPU status by itself: the Frame Interrupt, the Line Interrupt where the Line
+//Counter underflows, or the End of Frame. Interrupts are only scheduled while enabled, the
+//schedule must be checked again after each Register write
+uint32_t VDP::GetClocksToNextEvent()
+{
+	//Clocks to reach the given dot of the given scanline of the current Frame
+	auto clocksTo = [&](uint16_t line, uint16_t dot)
+	{
+		return (uint32_t)((line - VCount) * scanline_lenght + dot - HCount + 1);
+	};
+
+	//End of Frame, on the scanline change after the last scanline
+	uint32_t clocks = clocksTo(scanline_number - 1, scanline_lenght);
+
+	//Frame Interrupt at HCount 304 of the first scanline out of the Active Area
+	if ((reg1.ie0 == 1) && ((VCount < active_period) || ((VCount == active_period) && (HCount <= 304))))
+		clocks = std::min(clocks, clocksTo(active_period, 304));
+
+	//Line Interrupt at HCount 304 of the scanline where the Line Counter underflows. Outside the
+	//Active Area it only underflows after the End of Frame
+	if ((reg0.ie1 == 1) && (VCount <= active_period))
+	{
+		uint16_t line;
+
+		if (HCount == 0)
+			line = VCount + raster_counter;							//Not decremented on this scanline yet
+		else if ((raster_counter == 0xff) && (HCount <= 304))
+			line = VCount;											//Underflowed on this scanline
+		else if ((raster_counter == 0xff) && (HCount < scanline_lenght))
+			line = VCount + 1 + reg10;								//Reloaded at the end of this scanline
+		else
+			line = VCount + 1 + raster_counter;
+
+		if (line <= active_period)
+			clocks = std::min(clocks, clocksTo(line, 304));
 	}
 
-	if (checkRasterCounter())
+	return clocks;
+}
+
+//Number of clocks to run, the last one included, to reach the next point where the
+//V Counter can change, or the Status Register too when status is set: the Sprite
+//Overflow check at HCount 255 of the rendered scanlines and the VBlank Flag at HCount
+//303 of the first scanline out of the Active Area.
+uint16_t VDP::GetClocksToNextChange(bool status)
+{
+	uint16_t clocks = scanline_lenght - HCount + 1;
+
+	if (status)
 	{
-		//Try to Call CPU Maskable Line Interrupt
-		if (HCount == 304)
-			assertLineIrq();
+		if (reg1.blk && (HCount <= 0xff) && (VCount < (active_period + additional_scan)))
+			clocks = std::min<uint16_t>(clocks, 0xff - HCount + 1);
+
+		if ((VCount == active_period) && (HCount <= 303))
+			clocks = std::min<uint16_t>(clocks, 303 - HCount + 1);
 	}
 
-	//Increment Horizontal Counter
-	HCount++;
-	nCycleCounter++;
-		
-	return true;
+	return clocks;
+}
+
+//Beam position clocks dots after the last one the VDP was run to, computed without running the
+//VDP. HCount counts the dots run on the scanline, 342 once the last one is run
+void VDP::GetBeamPosition(uint32_t clocks, uint16_t& line, uint16_t& dot)
+{
+	uint32_t pos = VCount * scanline_lenght + HCount + clocks;
+
+	if (pos == 0)
+	{
+		line = 0;
+		dot = 0;
+		return;
+	}
+
+	line = (uint16_t)(((pos - 1) / scanline_lenght) % scanline_number);
+	dot = (uint16_t)((pos - 1) % scanline_lenght + 1);
+}
+
+//V Counter as read by the CPU clocks dots after the last one the VDP was run to
+uint8_t VDP::GetVCounter(uint32_t clocks)
+{
+	uint16_t line, dot;
+	GetBeamPosition(clocks, line, dot);
+
+	return vCounterTable[line];
+}
+
+//H Counter as read by the CPU clocks dots after the last one the VDP was run to
+uint8_t VDP::GetHCounter(uint32_t clocks)
+{
+	uint16_t line, dot;
+	GetBeamPosition(clocks, line, dot);
+
+	return (dot & 0x1fe) >> 1;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -335,10 +451,6 @@ void VDP::SetVideoStandard(uint8_t mode)
 		scanline_number = 313;
 		fFPS = 50;
 		//fFPS = 49.701459f;
-		//pFrameBuffer = new FrameBuffer(scanline_lenght, scanline_number);
-		pFrameBuffer = new FrameBuffer(256, 240);
-		pCharTable[0] = new FrameBuffer(128, 128);
-		pCharTable[1] = new FrameBuffer(128, 128);
 	}
 	else if (mode == NTSC)
 	{
@@ -347,22 +459,105 @@ void VDP::SetVideoStandard(uint8_t mode)
 		scanline_number = 262;
 		fFPS = 60;
 		//fFPS = 59.922743f;
-		//pFrameBuffer = new FrameBuffer(scanline_lenght, scanline_number);
-		pFrameBuffer = new FrameBuffer(256, 240);
-		pCharTable[0] = new FrameBuffer(128, 128);
-		pCharTable[1] = new FrameBuffer(128, 128);
+	}
+
+	UpdateCounterTable();
+}
+
+//Select the Pixel Format of the presentation surface, all the Colors are kept in it so Frames are
+//converted with a plain Palette lookup
+void VDP::SetPixelFormat(PIXELFORMAT format)
+{
+	pixelFormat = format;
+	frame.nPixelSize = (format == RGB565) ? 2 : 4;
+
+	//Autogenerate all 64 Color Palette Scaling RGB from 2bit to 8bit
+	//Color Value Stored in CRAM is used as an Index for the Palette.
+	//Note that in CRAM color are stores as 8 bit 00bbggrr
+	//TODO - Need to be checked for Color accuracy
+	for (uint8_t c = 0; c < 64; c++)
+	{
+		uint8_t r = ((c >> 0) & 0x03) * 0x55;
+		uint8_t g = ((c >> 2) & 0x03) * 0x55;
+		uint8_t b = ((c >> 4) & 0x03) * 0x55;
+
+		palARGB[c] = _rgba_to_int(r, g, b, 0xff);
+
+		switch (format)
+		{
+		case RGB565: palScreen[c] = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3); break;
+		case XRGB8888: palScreen[c] = _rgba_to_int(r, g, b, 0x00); break;
+		default: palScreen[c] = palARGB[c]; break;
+		}
+	}
+
+	//Convert the current CRAM, scanlines logged from now on take a new snapshot
+	for (uint8_t i = 0; i < 32; i++)
+		palHost[i] = palScreen[cram[i] & 0x3f];
+	nCramGeneration++;
+	bFrameConverted = false;
+}
+
+//Build the V Counter Table, the V Counter value of each scanline for the current Video Standard
+//and Resolution. It counts up to a jump point, then it goes on from a lower value up to 0xff
+void VDP::UpdateCounterTable()
+{
+	uint16_t jump = 0;
+	bool valid = true;
+
+	if (video_std == PAL)
+		jump = (active_period == 192) ? 0xf2 : (active_period == 224) ? 0x102 : 0x10a;
+	else
+	{
+		jump = (active_period == 192) ? 0xda : 0xea;
+		valid = (active_period != 240);
+	}
+
+	uint8_t delta = scanline_number - 256U;
+	for (uint16_t line = 0; line < scanline_number; line++)
+	{
+		if (!valid)
+			vCounterTable[line] = 0x00;
+		else
+			vCounterTable[line] = (line > jump) ? (uint8_t)(line - delta) : (uint8_t)line;
 	}
 }
 
 uint32_t* VDP::GetScreen()
 {
-	// Simply returns the current sprite holding the rendered screen
+	// Returns the rendered screen in ARGB8888, whatever the Host Pixel Format is
+	FlushScanlines();
+	if (!bFrameConverted)
+		ConvertFrame();
+
 	return pFrameBuffer->GetBuffer();
 }
 
+//Convert the rendered screen straight into the caller's memory, e.g. a locked streaming texture,
+//without going thru pFrameBuffer. The pitch is in bytes
+bool VDP::DrawScreen(void* pixels, int pitch)
+{
+	FlushScanlines();
+
+	FrameBuffer target(pixels, GetScreenWidth(), GetScreenHeight(), pitch);
+	renderer.ConvertFrame(frame, target);
+
+	return true;
+}
+
+//ARGB8888 Color of a single pixel, looked up straight from the Indexed Colour Frame
 uint32_t VDP::GetPixel(int x, int y)
 {
-	return pFrameBuffer->GetPixel(x, y);
+	FlushScanlines();
+
+	return palARGB[frame.lineCram[y][frame.indexBuffer[y * 256 + x] & 0x1f] & 0x3f];
+}
+
+//Convert the Indexed Colour Frame to ARGB8888 into pFrameBuffer, each scanline with its own CRAM snapshot
+void VDP::ConvertFrame()
+{
+	renderer.ConvertFrameARGB(frame, *pFrameBuffer, palARGB);
+	bFrameConverted = true;
 }
 
 uint16_t VDP::GetScreenWidth()
@@ -379,37 +574,44 @@ uint32_t VDP::GetColorFromCRam(uint8_t color, uint8_t palette)
 {
 	// Read the value from CRAM given: Color Index (0..15) and Palette (0..1)
 	// The value read from CRAM is used as an index for the Palette
-	// The Actual Palette Color is returned as RGB Value.
-	return palScreen[cram[(palette * 16) + color]];	
+	// The Actual Palette Color is returned as ARGB8888 Value, whatever the Host Pixel Format is.
+	return palARGB[cram[(palette * 16) + color] & 0x3f];
 }
 
+//Character Table view, the 256 Tiles of a table drawn in 16 rows of 16 with the given Palette.
+//Only the Tiles written since the last call are drawn again, all of them if the Palette or the
+//CRAM changed
 uint32_t* VDP::GetCharTable(uint8_t table, uint8_t palette)
 {
-	for (uint16_t nTileY = 0; nTileY < 16; nTileY++)
+	table &= 0x01;
+	palette &= 0x01;
+
+	if ((charTablePalette[table] != palette) || (charTableCramGeneration[table] != nCramGeneration))
 	{
-		for (uint16_t nTileX = 0; nTileX < 16; nTileX++)
+		std::fill_n(&charTileDirty[table * 256], 256, true);
+		charTablePalette[table] = palette;
+		charTableCramGeneration[table] = nCramGeneration;
+	}
+
+	for (uint16_t nTile = 0; nTile < 256; nTile++)
+	{
+		uint16_t tile = table * 256 + nTile;
+		if (!charTileDirty[tile])
+			continue;
+
+		uint16_t nTileX = nTile & 0x0f;
+		uint16_t nTileY = nTile >> 4;
+		for (uint16_t row = 0; row < 8; row++)
 		{
-			uint16_t nOffset = nTileY * 512 + nTileX * 32;
-			for (uint16_t row = 0; row < 8; row++)
-			{
-				uint8_t bitplane0 = vram[table * 0x2000 + nOffset + row * 0x0004];
-				uint8_t bitplane1 = vram[table * 0x2000 + nOffset + row * 0x0004 + 1];
-				uint8_t bitplane2 = vram[table * 0x2000 + nOffset + row * 0x0004 + 2];
-				uint8_t bitplane3 = vram[table * 0x2000 + nOffset + row * 0x0004 + 3];
-				for (uint16_t col = 0; col < 8; col++)
-				{
-					uint8_t pixel = ((bitplane0 >> 7) * 1) +
-									((bitplane1 >> 7) * 2) +
-									((bitplane2 >> 7) * 4) +
-									((bitplane3 >> 7) * 8);
-
-					bitplane0 = bitplane0 << 1; bitplane1 = bitplane1 << 1;
-					bitplane2 = bitplane2 << 1; bitplane3 = bitplane3 << 1;
-					
-					pCharTable[table]->SetPixel(nTileX * 8 + col, nTileY * 8 + row, GetColorFromCRam(pixel, palette));
-				}
-			}
+			uint8_t pixels[8];
+			PlanarToChunky::Convert(&vram[tile * 32 + row * 4], pixels, false);
+
+			uint32_t* dst = (uint32_t*)pCharTable[table]->GetLine(nTileY * 8 + row) + nTileX * 8;
+			for (uint16_t col = 0; col < 8; col++)
+				dst[col] = GetColorFromCRam(pixels[col], palette);
 		}
+
+		charTileDirty[tile] = false;
 	}
 
 	return pCharTable[table]->GetBuffer();
@@ -440,12 +642,27 @@ bool VDP::writeDataPort(uint8_t data)
 	//Reset First Byte Received Flag
 	bFirstByteRecv = false;
 
+	//VRAM writes must not be seen by the scanlines logged before, render them first. Writes
+	//to the Sprite Y coordinates invalidate the Sprite Evaluation Cache
+	if (code_reg != 3)
+	{
+		FlushScanlines();
+		if ((uint16_t)(addr_reg - sprAttrTabAddr) < 64)
+			bSpriteCacheDirty = true;
+
+		//The Tile must be decoded again, here and on the Render Thread, and drawn again on the
+		//Character Tables
+		renderer.InvalidateTile(addr_reg >> 5);
+		tileWritten[addr_reg >> 5] = true;
+		charTileDirty[addr_reg >> 5] = true;
+	}
+
 	switch (code_reg)
 	{
-	case 0: vram[addr_reg++] = data; addr_reg &= 0x3fff; read_buf = data; break;					//VRAM Read Mode, Write is Deprecated but works
-	case 1: vram[addr_reg++] = data; addr_reg &= 0x3fff; read_buf = data; break;					//VRAM Write Mode, it also load Read Buffer
-	case 2: vram[addr_reg++] = data; addr_reg &= 0x3fff; break;										//Register Write Mode, VRAM Write is deprecated
-	case 3: cram[addr_reg & 0x001f] = data; addr_reg++; addr_reg &= 0x3fff; read_buf = data; break;	//CRAM Write Mode, it also load Read Buffer
+	case 0: vram[addr_reg++] = data; addr_reg &= 0x3fff; read_buf = data; break;	//VRAM Read Mode, Write is Deprecated but works
+	case 1: vram[addr_reg++] = data; addr_reg &= 0x3fff; read_buf = data; break;	//VRAM Write Mode, it also load Read Buffer
+	case 2: vram[addr_reg++] = data; addr_reg &= 0x3fff; break;					//Register Write Mode, VRAM Write is deprecated
+	case 3: cram[addr_reg & 0x001f] = data; palHost[addr_reg & 0x001f] = palScreen[data & 0x3f]; nCramGeneration++; addr_reg++; addr_reg &= 0x3fff; read_buf = data; break;	//CRAM Write Mode, it also load Read Buffer and Host Palette
 	}
 
 	return true;
@@ -459,12 +676,15 @@ bool VDP::readControlPort(uint8_t& data)
 
 	//Read Status Register
 	data = status.b;
+	if (status.vblank | status.sprovf | status.sprcol)
+		nStatusGeneration++;
 
 	//Reset vBlank Interupt Flag
 	status.vblank = 0;
 
-	//Reset SpriteOverflow Flag
+	//Reset SpriteOverflow & Sprite Collision Flags
 	status.sprovf = 0;
+	status.sprcol = 0;
 
 	return true;
 }
@@ -590,12 +810,12 @@ bool VDP::writeRegister()
 	//command_word LSB is copied in the selected Register.
 	switch ((command_word >> 8) & 0x0f)
 	{
-	case 0x00: reg0.b = (uint8_t)command_word; setVideoMode(); break;
-	case 0x01: reg1.b = (uint8_t)command_word; setVideoMode(); break;
+	case 0x00: reg0.b = (uint8_t)command_word; setVideoMode(); UpdateCounterTable(); bSpriteCacheDirty = true; break;
+	case 0x01: reg1.b = (uint8_t)command_word; setVideoMode(); UpdateCounterTable(); bSpriteCacheDirty = true; break;
 	case 0x02: reg2 = (uint8_t)command_word; break;
 	case 0x03: reg3 = (uint8_t)command_word; break;
 	case 0x04: reg4 = (uint8_t)command_word; break;
-	case 0x05: reg5 = (uint8_t)command_word; setSpriteAttributeTableAddr(); break;
+	case 0x05: reg5 = (uint8_t)command_word; setSpriteAttributeTableAddr(); bSpriteCacheDirty = true; break;
 	case 0x06: reg6 = (uint8_t)command_word; setNameTableAddr(); break;
 	case 0x07: reg7 = (uint8_t)command_word; break;
 	case 0x08: reg8 = (uint8_t)command_word; break;
@@ -611,290 +831,141 @@ bool VDP::writeRegister()
 //                      Background & Sprite Renderer
 //
 ////////////////////////////////////////////////////////////////////////////////
-bool VDP::RenderBackground(uint8_t priority)
-{
-	NameTableEntry elem;
-	uint16_t nameTableOffset;
-	uint16_t tileOffset;
-	uint16_t tileLineAddr;
-
-	uint8_t current_row = VCount >> 3;
-	uint8_t current_col = HCount >> 3;
-	uint8_t vscroll_row = reg9 >> 3;
-	uint8_t hscroll_col = 0x20 - (reg8 >> 3);
-	uint8_t vscroll_fine = reg9 & 0x07;
-	uint8_t hscroll_fine = reg8 & 0x07;
-	
-	uint8_t starting_row;
-	uint8_t starting_col;
+//Scanlines drawn into the Frame Buffer, the Active Area plus the additional lines used for
+//Scrolling. 224 and 240 lines modes would go past the 240 lines of the Frame Buffer
+uint16_t VDP::GetRenderedLines()
+{
+	return std::min<uint16_t>(active_period + additional_scan, pFrameBuffer->GetHeight());
+}
 
-	uint8_t x, y;
+//Write a pixel of the Indexed Colour Frame
+void VDP::SetPixelIndex(int x, int y, uint8_t index)
+{
+	int offset = x + y * 256;
+
+	if ((offset >= 0) && (offset < (int)frame.indexBuffer.size()))
+		frame.indexBuffer[offset] = index;
+
+	bFrameConverted = false;
+}
 
-	//Render one full scanline at a time for Active Period Only
-	if (HCount == 0xff)
+//Take a copy of the Host Palette and of the CRAM for the current scanline, unless the CRAM didn't change
+//since the last one
+void VDP::SnapshotCram()
+{
+	if (frame.lineCramGeneration[VCount] != nCramGeneration)
 	{
-		//Go thru all 32 column
-		for (uint8_t col = 0; col < 32; col++)
-		{
-			//Check if Horizontal Scroll in inibited for Rows 0-1 and set starting Column according
-			//to Hardware Horizontal Scrolling Register Reg8
-			if (reg0.hsi)
-			{
-				//Horizontal Scrolling Disabled for Row 0-1
-				if (current_row < 2)
-				{
-					starting_col = col;
-				}
-				else
-				{
-					starting_col = (col + hscroll_col) % 32;
-				}
-			}
-			else
-			{
-				starting_col = (col + hscroll_col) % 32;
-			}
-
-			//Check if Vertical Scroll in inibited for Columns 24-31 and set starting Row according
-			//to Hardware Vertical Scrolling Register Reg9
-			if (reg0.vsi)
-			{
-				//Vertical Scrolling Disabled for Columns 24 - 31
-				if (col < 25)
-				{
-					starting_row = ((VCount + reg9) >> 3) % row_number;
-				}
-				else
-				{
-					starting_row = current_row;
-				}
-			}
-			else
-			{
-				starting_row = ((VCount + reg9) >> 3) % row_number;
-			}
-
-			//Set Name Table Offset according to Starting Row and Columnw
-			//Each Name Table Entry is 2 Byte per Tile
-			nameTableOffset = nameTabAddr + starting_col * 2 + starting_row * 64;
-
-			//Read Name Table Entry for current Tile (2 Byte)
-			elem.lsb = vram[nameTableOffset];
-			elem.msb = vram[nameTableOffset + 1];
-
-			//Point to Tile in VRAM
-			tileOffset = elem.char_id * 32;
-
-			//Read all 4 bitplane for current Tile Line
-			//Specific Line is swapped Horizontally and/or Vertically according
-			//to Name Table Entry flags 
-			for (int i = 0; i < 4; i++)
-			{
-				//Define Tile Line Address in VRAM according to Vertical Scrolling Settings
-				uint8_t vline_offset;
-				if (reg0.vsi)
-				{
-					//Vertical Scrolling Disabled for Columns 24 - 31
-					if (current_col < 25)
-					{
-						vline_offset = (VCount + vscroll_fine) % 8;
-					}
-					else
-					{
-						vline_offset = (VCount % 8);
-					}
-				}
-				else
-				{
-					vline_offset = (VCount + vscroll_fine) % 8;
-				}
-				
-				//Check if the tile is Flipped Vertically
-				if (elem.vflip)
-				{
-					tileLineAddr = tileOffset + (7 - vline_offset) * 0x04 + i;
-				}
-				else
-				{
-					tileLineAddr = tileOffset + vline_offset * 0x04 + i;
-				}
-
-				//Check if the Tile is flipped Horizontally
-				if (elem.hflip)
-				{
-					bplShifter.LoadBitplane(i, _bitswap_uint8(vram[tileLineAddr]));
-				}
-				else
-				{
-					bplShifter.LoadBitplane(i, vram[tileLineAddr]);
-				}
-			}
-			
-			//Render a full line (8 pixel) of the current Tile
-			if (elem.priority == priority)
-			{
-				for (int j = 0; j < 8; j++)
-				{
-					//Get Color Value for Each Pixel
-					uint8_t color = bplShifter.GetPixelColor();
-
-					//Set Screen Renderer Coordinates according to Scrolling Settings
-					if (reg0.hsi)
-					{
-						//Horizontal Scrolling Disabled for Row 0-1
-						if (current_row < 2)
-						{
-							x = col * 8 + j;
-						}
-						else
-						{
-							x = col * 8 + j + hscroll_fine;
-						}
-					}
-					else
-					{
-						x = col * 8 + j + hscroll_fine;
-					}
-					
-					y = VCount;
-					
-					//Render Pixel - Color 0 is always transparent.
-					if (color != 0x00)
-						pFrameBuffer->SetPixel(x, y, GetColorFromCRam(color, elem.palette));
-				}
-			}
-		}
+		frame.linePalette[VCount] = palHost;
+		frame.lineCram[VCount] = cram;
+		frame.lineCramGeneration[VCount] = nCramGeneration;
 	}
-
-	return true;
 }
 
-bool VDP::RenderSprites()
+//Record the registers the current scanline is rendered with in the Raster Register Log, and
+//evaluate its Sprites now since the Status Register depends on them
+void VDP::LogScanline()
 {
-	auto spriteOnScanline = [&](uint8_t y)
+	//Lines skipped since the last one logged (the Video Mode changed) are not rendered
+	for (; frame.nLoggedLines < VCount; frame.nLoggedLines++)
+		frame.lineLog[frame.nLoggedLines].bDisplay = false;
+
+	RasterLine& ls = frame.lineLog[VCount];
+	ls.reg0 = reg0.b;
+	ls.reg6 = reg6;
+	ls.reg7 = reg7;
+	ls.reg8 = reg8;
+	ls.reg9 = reg9;
+	ls.nameTabAddr = nameTabAddr;
+	ls.sprAttrTabAddr = sprAttrTabAddr;
+	ls.active_period = active_period;
+	ls.row_number = row_number;
+	ls.bDisplay = reg1.blk;
+
+	//Sprites on this scanline from the Sprite Evaluation Cache
+	if (bSpriteCacheDirty)
+		BuildSpriteCache();
+
+	ls.sprCounter = lineSpriteCount[VCount];
+	for (uint8_t i = 0; i < ls.sprCounter; i++)
+		ls.sprBuffer[i] = lineSprites[VCount][i];
+
+	//Set Sprite Overflow Flag on the Status Register
+	if (reg1.blk && lineSpriteOverflow[VCount])
 	{
-		int upper, lower;
+		status.sprovf = 1;
+		nStatusGeneration++;
+	}
 
-		if ((y >= active_period) && (y <= 0xff))
-		{ 
-			upper = y - 256;
-		}
-		else
-		{
-			upper = y;
-		}
+	//Set Sprite Collision Flag on the Status Register if two Sprites have an opaque pixel in common
+	if (reg1.blk && !status.sprcol && (ls.sprCounter > 1) && renderer.SpriteCollision(VCount, ls, vram.data()))
+	{
+		status.sprcol = 1;
+		nStatusGeneration++;
+	}
 
-		lower = upper + 7 + 8 * reg1.sz;
-		
-		if ((VCount >= upper) && (VCount <= lower))
-		{
-			return true;
-		}
-		else
-		{
-			return false;
-		}
-	};
-	
-	//Render one full scanline at a time for Active Period Only
-	if (HCount == 0xff)
+	frame.nLoggedLines = VCount + 1;
+}
+
+//Render the logged scanlines not rendered yet. Called at the End of Frame, when the Frame is
+//requested and before any VRAM write, which the pending scanlines may still need
+void VDP::FlushScanlines()
+{
+	//Skipped Frames keep the pixels of the last rendered one
+	if (bSkipFrame)
 	{
-		//Scan Sprite Attribute Table vpos for this scanline
-		sprCounter = 0;
-		for (uint8_t i = 0; i < 64; i++)
-		{
-			uint8_t vpos = vram[sprAttrTabAddr + i];
-
-			//if vertical resolution is 192 and Sprite Y coordinate is 0xd0 stop searching
-			if (active_period == 192 && vpos == 0xd0)
-				break;
-			
-			//VPOS id stored as minus one, a value of 1 refer to scanline 2 (counting from zero)
-			vpos += 1;
-		
-			//Check which sprite falls on this scanline depending on its vpos and height
-			if (spriteOnScanline(vpos))
-			{
-				if (sprCounter < MAXSPRITEPERLINE)
-				{
-					//Put Sprite Position on Sprite Attribute Table on the Sprite Buffer
-					sprBuffer[sprCounter] = i;
-					sprCounter++;
-				}
-				else
-				{
-					//Set Sprite Overflow Flag on the Status Register
-					status.sprovf = 1;
-					break;
-				}
-			}
-		}
+		frame.nRenderedLines = frame.nLoggedLines;
+		return;
+	}
 
-		//if Sprite Buffer is not Empty Draw Sprite on this Scanline
-		if (sprCounter != 0)
-		{
-			for (uint8_t i = 0; i < sprCounter; i++)
-			{
-				//Extract Current Sprite Attributes from Attribute Table
-				uint8_t sprY = vram[sprAttrTabAddr + sprBuffer[i]] + 1;
-				uint8_t sprX = vram[sprAttrTabAddr + 0x80 + sprBuffer[i] * 2];
-				uint16_t sprID = vram[sprAttrTabAddr + 0x80 + sprBuffer[i] * 2 + 1];
-
-				//Update sprID according to Reg6 Setting, it select beetwen first 256 tile and second 256 Tiles
-				if (((reg6 >> 2) & 0x01) == 1)
-				{
-					sprID += 256;
-				}
-
-				//Read all 4 bitplane for current Sprite Line, Fifth Bitplane in always 0xff
-				uint16_t sprLineAddr;
-				uint8_t sprLineOffset;
-
-				for (uint8_t j = 0; j < 4; j++)
-				{
-					
-					if ((sprY >= active_period) && (sprY <= 0xff))
-					{
-						sprLineOffset = VCount - (sprY - 256);
-					}
-					else
-					{
-						sprLineOffset = VCount - sprY;
-					}
-
-					sprLineAddr = sprID * 32 + sprLineOffset * 4 + j;
-					bplShifter.LoadBitplane(j, vram[sprLineAddr]);
-				}
-				
-				//Render Sprite Line
-				for (uint8_t k = 0; k < 8; k++)
-				{
-					uint8_t color = bplShifter.GetPixelColor();
-
-					//Don't draw pixel if color is transparent (Palette 1, Color #0)
-					if (color != 0x00)
-					{
-						pFrameBuffer->SetPixel(sprX + k - 8 * reg0.ss, VCount, GetColorFromCRam(color, 1));
-					}
-				}
-			}
-		}
+	if (renderer.RenderLines(frame, vram.data()))
+		bFrameConverted = false;
+}
+
+//Render the logged scanlines of the Frame. With a Render Thread attached they're handed over
+//to it with a copy of the VRAM, and never rendered by the VDP itself
+void VDP::RenderFrame()
+{
+	if ((pRenderThread == nullptr) || bSkipFrame)
+	{
+		FlushScanlines();
+		return;
 	}
-	
-	return true;
+
+	pRenderThread->Submit(frame, vram, tileWritten);
+	tileWritten.fill(false);
+	frame.nRenderedLines = frame.nLoggedLines;
 }
 
-bool VDP::MaskColumnOne()
+//Rebuild the Sprite Evaluation Cache, the list of Sprites falling on each scanline in Sprite
+//Attribute Table order. Only the first 8 are kept, a ninth sets the Overflow flag for that line
+void VDP::BuildSpriteCache()
 {
-	if (HCount == 0xff)
+	lineSpriteCount.fill(0);
+	lineSpriteOverflow.fill(false);
+
+	for (uint8_t i = 0; i < 64; i++)
 	{
-		if (reg0.lcb)
+		uint8_t vpos = vram[sprAttrTabAddr + i];
+
+		//if vertical resolution is 192 and Sprite Y coordinate is 0xd0 stop searching
+		if (active_period == 192 && vpos == 0xd0)
+			break;
+
+		//VPOS id stored as minus one, a value of 1 refer to scanline 2 (counting from zero)
+		vpos += 1;
+
+		//Sprites below the Active Area wrap around to the top of the screen
+		int upper = (vpos >= active_period) ? vpos - 256 : vpos;
+		int lower = upper + 7 + 8 * reg1.sz;
+
+		for (int line = std::max(upper, 0); line <= std::min(lower, 0xff); line++)
 		{
-			for (int i = 0; i < 8; i++)
-				pFrameBuffer->SetPixel(i, VCount, GetColorFromCRam(reg7 & 0x0f, 1));
+			if (lineSpriteCount[line] < MAXSPRITEPERLINE)
+				lineSprites[line][lineSpriteCount[line]++] = i;
+			else
+				lineSpriteOverflow[line] = true;
 		}
 	}
-	
-	return true;
-};
 
+	bSpriteCacheDirty = false;
+}
@@ -1,25 +1,11 @@
 #pragma once
 #include <cstdint>
 #include <array>
-#include "bitplaneshifter.h"
 #include "framebuffer.h"
+#include "scanlinerenderer.h"
 
 class SMS;
-
-#define MAXSPRITEPERLINE	8
-
-union NameTableEntry {
-	struct { uint8_t lsb, msb; };
-	uint16_t w;
-	struct {
-		uint16_t char_id : 9;
-		uint16_t hflip : 1;
-		uint16_t vflip : 1;
-		uint16_t palette : 1;
-		uint16_t priority : 1;
-		uint16_t : 3;
-	};
-};
+class RenderThread;
 
 class VDP
 {
@@ -36,6 +22,13 @@ public:
 		PAL = 0,
 		NTSC = 1
 	};
+
+	enum PIXELFORMAT
+	{
+		ARGB8888 = 0,
+		XRGB8888 = 1,
+		RGB565 = 2
+	};
 	
 	// --------------------- VDP Internal Registers ----------------------------
 	union {
@@ -85,12 +78,23 @@ public:
 
 	void ConnectBus(SMS* n) { sms = n; }
 	void SetVideoStandard(uint8_t mode);
+	void SetPixelFormat(PIXELFORMAT format);
+	PIXELFORMAT GetPixelFormat() const { return pixelFormat; }
+	uint8_t GetPixelSize() const { return frame.nPixelSize; }
 	bool read(uint8_t addr, uint8_t& data);
 	bool write(uint8_t addr, uint8_t data);
 	bool reset();
-	bool clock();
+	bool run(uint32_t clocks);
+	uint32_t GetClocksToNextEvent();
+	uint16_t GetClocksToNextChange(bool status);
+	uint32_t GetStatusGeneration() const { return nStatusGeneration; }
+	uint8_t GetVCounter(uint32_t clocks);
+	uint8_t GetHCounter(uint32_t clocks);
+	void AttachRenderThread(RenderThread* p) { pRenderThread = p; }
+	void SetSkipFrame(bool skip);
 	
 	uint32_t* GetScreen();
+	bool DrawScreen(void* pixels, int pitch);
 	uint32_t GetPixel(int x, int y);
 	uint16_t GetScreenWidth();
 	uint16_t GetScreenHeight();
@@ -98,11 +102,26 @@ public:
 	uint32_t GetColorFromCRam(uint8_t color, uint8_t palette);
 		
 private:
-	uint32_t  palScreen[0x40];						//SMS Palette, contains all 64 Colors available in RGBA format
+	uint32_t  palScreen[0x40];						//SMS Palette, contains all 64 Colors available in the Host Pixel Format
+	uint32_t  palARGB[0x40];						//SMS Palette in ARGB8888, for the Screen and Character Table views
+	std::array<uint32_t, 32> palHost;				//Host Color of each CRAM entry, updated on CRAM writes
+	PIXELFORMAT pixelFormat;						//Pixel Format of the presentation surface
 	FrameBuffer* pRenderBuffer;						//Render Buffer, used to render all the scanlines including overscan
-	FrameBuffer* pFrameBuffer;						//Frame Buffer, contain only the visible part of the Render Buffer 
-	FrameBuffer* pCharTable[2];						//Character Table split in two Tables (0x000-0x0ff) and (0x100 - 0x1ff), debub only 
-	BitplaneShifter	bplShifter{ 4 };				//Bitplane Shift Register, used to extract Color Value for each Pixel
+	FrameBuffer* pFrameBuffer;						//Frame Buffer, contain only the visible part of the Render Buffer, always ARGB8888
+	FrameBuffer* pCharTable[2];						//Character Table split in two Tables (0x000-0x0ff) and (0x100 - 0x1ff), debub only, always ARGB8888
+	std::array<bool, 512> charTileDirty;			//Tiles to draw again on the Character Tables
+	std::array<uint8_t, 2> charTablePalette;		//Palette each Character Table was drawn with
+	std::array<uint32_t, 2> charTableCramGeneration;	//CRAM Generation each Character Table was drawn with
+
+	//Indexed Colour Frame with the Raster Register Log of the current Frame. It's converted to ARGB8888
+	//into pFrameBuffer only when requested, to the Host Pixel Format by DrawScreen()
+	RasterFrame frame;
+	ScanlineRenderer renderer;
+	uint32_t nCramGeneration;							//Incremented on every CRAM write
+	bool bFrameConverted;								//pFrameBuffer is up to date with the Indexed Colour Frame
+	RenderThread* pRenderThread;						//Renders the Frames instead of the VDP if attached
+	bool bSkipFrame;									//No pixel is drawn in the current Frame, Sprites are still evaluated
+	std::array<bool, 512> tileWritten;					//Tiles written since the last Frame handed to the Render Thread
 	
 	std::array<uint8_t, 16 * 1024> vram;			//VDP 16K Video RAM
 	std::array<uint8_t, 32 > cram;					//VDP 32 Byte Color Palette RAM
@@ -114,6 +133,7 @@ private:
 	uint16_t scanline_lenght, scanline_number;
 	uint32_t nFrameCounter;
 	uint32_t nCycleCounter;
+	uint32_t nStatusGeneration;						//Incremented whenever the V Counter or the Status Register change
 	
 	bool bFirstByteRecv;
 	uint8_t read_buf;								//VDP Read Buffer
@@ -127,11 +147,18 @@ private:
 	uint16_t additional_scan;						//VDP Additional Scan Line, used for Scrolling - Depends on Resolution
 	uint8_t raster_counter;							//Line Counter used for Line Interrupt - Set by RegA
 
+	std::array<uint8_t, 313> vCounterTable;			//V Counter value of each scanline, for the Video Standard and Resolution
+	std::array<uint16_t, 343> nextEventDot;			//First dot needing RunEvent() from each HCount value
+
 	uint8_t col_counter, row_counter;				//Column and Row counters, used for rendering
 	uint8_t row_number;								//Number of Row per Frame, depends on Resolution (28 or 32)
 	
-	uint8_t sprBuffer[64];							//Internal Sprite Buffer, used for rendering Sprite
-	uint8_t sprCounter;								//Number of Sprite on the Sprite Buffer, used for rendering Sprite
+	//Sprite Evaluation Cache, the Sprites on each scanline (up to 8) and its Overflow flag. Rebuilt
+	//on first use after a write to the Sprite Y coordinates or to Reg0, Reg1 and Reg5
+	std::array<std::array<uint8_t, MAXSPRITEPERLINE>, 256> lineSprites;
+	std::array<uint8_t, 256> lineSpriteCount;
+	std::array<bool, 256> lineSpriteOverflow;
+	bool bSpriteCacheDirty;
 		
 	//Read/Write VRAM, CRAM, Register
 	bool readDataPort(uint8_t& data);
@@ -140,11 +167,20 @@ private:
 	bool writeControlPort(uint8_t data);
 	bool writeRegister();
 
-	inline uint8_t _bitswap_uint8(uint8_t x);
 	inline uint32_t _rgba_to_int(uint8_t r, uint8_t g, uint8_t b, uint8_t a);
 
-	bool RenderBackground(uint8_t priority);
-	bool RenderSprites();
-	bool MaskColumnOne();
+	bool RunEvent();
+	void GetBeamPosition(uint32_t clocks, uint16_t& line, uint16_t& dot);
+	void UpdateCounterTable();
+
+	void SetPixelIndex(int x, int y, uint8_t index);
+	void SnapshotCram();
+	void ConvertFrame();
+
+	uint16_t GetRenderedLines();
+	void LogScanline();
+	void FlushScanlines();
+	void RenderFrame();
+	void BuildSpriteCache();
 };
 